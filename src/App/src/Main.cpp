@@ -37,12 +37,13 @@ namespace OpenLoco
         std::cout << "                join [options] <address>" << std::endl;
         std::cout << "                uncompress [options] <path>" << std::endl;
         std::cout << "                simulate [options] <path> <ticks> [path]" << std::endl;
+        std::cout << "                bench [options] <path> <ticks>" << std::endl;
         std::cout << "                compare [options] <path1> <path2>" << std::endl;
         std::cout << std::endl;
         std::cout << "options:" << std::endl;
         std::cout << "--bind                     Address to bind to when hosting a server" << std::endl;
         std::cout << "--port               -p     Port number for the server" << std::endl;
-        std::cout << "                     -o     Output path" << std::endl;
+        std::cout << "                     -o     Output path (for bench, the JSON report path)" << std::endl;
         std::cout << "--help               -h     Print help" << std::endl;
         std::cout << "--version                   Print version" << std::endl;
         std::cout << "--intro                     Run the game intro" << std::endl;
@@ -52,6 +53,7 @@ namespace OpenLoco
         std::cout << "                              Example: --log_levels \"all, -verbose\", logs all but verbose levels" << std::endl;
         std::cout << "                              Default: \"info, warning, error\"" << std::endl;
         std::cout << "--all                -a     For compare, print out all divergences" << std::endl;
+        std::cout << "--trace                     For bench, write a Chrome trace of the profiler zones" << std::endl;
         std::cout << "--locomotion_path           Overrides the path to Locomotion install." << std::endl;
     }
 
@@ -202,6 +204,34 @@ namespace OpenLoco
         return EXIT_SUCCESS;
     }
 
+    static int bench(const CommandLineOptions& options)
+    {
+        if (!options.ticks)
+        {
+            Logging::error("Number of ticks to benchmark not specified");
+            return EXIT_FAILURE;
+        }
+
+        auto inPath = fs::u8path(options.path);
+        auto reportPath = fs::u8path(options.outputPath);
+        auto tracePath = fs::u8path(options.tracePath);
+
+        try
+        {
+            if (!OpenLoco::benchmarkGame(inPath, *options.ticks, reportPath, tracePath))
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        catch (...)
+        {
+            Logging::error("Unable to load and benchmark {}", inPath.u8string());
+            return EXIT_FAILURE;
+        }
+
+        return EXIT_SUCCESS;
+    }
+
     static int compare(const CommandLineOptions& options)
     {
         auto file1 = fs::u8path(options.path);
@@ -271,6 +301,8 @@ namespace OpenLoco
                 return uncompressFile(options);
             case CommandLineAction::simulate:
                 return simulate(options);
+            case CommandLineAction::bench:
+                return bench(options);
             case CommandLineAction::compare:
                 return compare(options);
             default:
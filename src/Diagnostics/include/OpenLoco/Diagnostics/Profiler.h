@@ -0,0 +1,140 @@
+#pragma once
+
+#include <OpenLoco/Core/FileSystem.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace OpenLoco::Diagnostics::Profiler
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Each thread keeps its most recent events in a ring buffer of this size,
+    // older events are overwritten. Must be a power of two.
+    static constexpr size_t kEventsPerThread = 1U << 15;
+
+    // Zone names are stored by pointer in the event buffers, so only string
+    // literals are accepted.
+    class ZoneName
+    {
+        const char* _name;
+
+    public:
+        template<size_t TSize>
+        consteval ZoneName(const char (&name)[TSize])
+            : _name(name)
+        {
+        }
+
+        constexpr const char* c_str() const noexcept
+        {
+            return _name;
+        }
+    };
+
+    struct ZoneEvent
+    {
+        const char* name;
+        int64_t start; // Nanoseconds since the profiler epoch.
+        int64_t end;
+        uint32_t depth;
+    };
+
+    // Aggregated timing of a zone over a single frame.
+    struct ZoneStats
+    {
+        const char* name;
+        uint32_t depth;
+        uint32_t calls;
+        uint32_t threads;
+        double totalMs;
+        double maxMs;
+    };
+
+    struct FrameStats
+    {
+        double frameMs;
+        std::vector<ZoneStats> zones;
+    };
+
+    namespace Detail
+    {
+        extern std::atomic<bool> _enabled;
+
+        uint32_t beginZone();
+        void endZone(const char* name, Clock::time_point start, uint32_t depth);
+    }
+
+    inline bool isEnabled()
+    {
+        return Detail::_enabled.load(std::memory_order_relaxed);
+    }
+
+    void setEnabled(bool enabled);
+
+    // A capture keeps recording regardless of what else toggles the profiler
+    // (such as the overlay) until it is ended. Beginning a capture discards
+    // all previously recorded events, ending it keeps them for export.
+    void beginCapture();
+    void endCapture();
+    bool isCapturing();
+
+    // Discards all recorded events on every thread.
+    void reset();
+
+    // Closes the current frame, the zones that ended since the previous call
+    // become available through getLastFrameStats. Must not be called while
+    // other threads are inside a zone.
+    void endFrame();
+
+    const FrameStats& getLastFrameStats();
+
+    // Number of events overwritten in the ring buffers since the last reset,
+    // these are missing from the trace.
+    uint64_t getDroppedEventCount();
+
+    // All events still held in the per thread ring buffers, in Chrome trace
+    // event format (chrome://tracing, Perfetto). The number of dropped events
+    // is stored in otherData.droppedEvents.
+    std::string getChromeTrace();
+    // Logs a warning when the trace is missing dropped events.
+    bool exportChromeTrace(const fs::path& path);
+
+    class ScopedZone
+    {
+        const char* _name = nullptr;
+        Clock::time_point _start;
+        uint32_t _depth = 0;
+
+    public:
+        ScopedZone(ZoneName name)
+        {
+            if (isEnabled())
+            {
+                _name = name.c_str();
+                _depth = Detail::beginZone();
+                _start = Clock::now();
+            }
+        }
+
+        ~ScopedZone()
+        {
+            if (_name != nullptr)
+            {
+                Detail::endZone(_name, _start, _depth);
+            }
+        }
+
+        ScopedZone(const ScopedZone&) = delete;
+        ScopedZone& operator=(const ScopedZone&) = delete;
+    };
+}
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+#define OPENLOCO_PROFILE_CONCAT_IMPL(a, b) a##b
+#define OPENLOCO_PROFILE_CONCAT(a, b) OPENLOCO_PROFILE_CONCAT_IMPL(a, b)
+#define OPENLOCO_PROFILE_ZONE(name) const ::OpenLoco::Diagnostics::Profiler::ScopedZone OPENLOCO_PROFILE_CONCAT(_profileZone, __LINE__)(name)
+// NOLINTEND(cppcoreguidelines-macro-usage)
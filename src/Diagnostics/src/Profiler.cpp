@@ -0,0 +1,254 @@
+#include "Profiler.h"
+#include "Logging.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <fmt/format.h>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+namespace OpenLoco::Diagnostics::Profiler
+{
+    struct ThreadBuffer
+    {
+        std::array<ZoneEvent, kEventsPerThread> events{};
+
+        // Total number of events ever written, only incremented by the owning thread.
+        std::atomic<uint64_t> writeCount{};
+
+        // Number of events already consumed by endFrame, only touched by the frame thread.
+        uint64_t frameReadCount{};
+
+        uint32_t depth{};
+        uint32_t threadIndex{};
+    };
+
+    static const Clock::time_point _epoch = Clock::now();
+    static std::mutex _threadsMutex;
+    static std::vector<std::shared_ptr<ThreadBuffer>> _threads;
+    static FrameStats _lastFrameStats;
+    static int64_t _lastFrameEnd{};
+    static bool _isCapturing = false;
+
+    namespace Detail
+    {
+        std::atomic<bool> _enabled{ false };
+    }
+
+    static int64_t toNanoseconds(Clock::time_point time)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time - _epoch).count();
+    }
+
+    static ThreadBuffer& getThreadBuffer()
+    {
+        // The registry keeps the buffer alive after the thread exits so its events
+        // can still be exported.
+        thread_local std::shared_ptr<ThreadBuffer> buffer = [] {
+            auto newBuffer = std::make_shared<ThreadBuffer>();
+
+            std::lock_guard lock(_threadsMutex);
+            newBuffer->threadIndex = static_cast<uint32_t>(_threads.size());
+            _threads.push_back(newBuffer);
+            return newBuffer;
+        }();
+        return *buffer;
+    }
+
+    uint32_t Detail::beginZone()
+    {
+        return getThreadBuffer().depth++;
+    }
+
+    void Detail::endZone(const char* name, Clock::time_point start, uint32_t depth)
+    {
+        const auto end = Clock::now();
+
+        auto& buffer = getThreadBuffer();
+        buffer.depth = depth;
+
+        const auto index = buffer.writeCount.load(std::memory_order_relaxed);
+        buffer.events[index & (kEventsPerThread - 1)] = ZoneEvent{ name, toNanoseconds(start), toNanoseconds(end), depth };
+        buffer.writeCount.store(index + 1, std::memory_order_release);
+    }
+
+    void setEnabled(bool enabled)
+    {
+        if (enabled && !isEnabled())
+        {
+            _lastFrameEnd = toNanoseconds(Clock::now());
+        }
+        Detail::_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void beginCapture()
+    {
+        _isCapturing = true;
+        reset();
+        setEnabled(true);
+    }
+
+    void endCapture()
+    {
+        _isCapturing = false;
+        setEnabled(false);
+    }
+
+    bool isCapturing()
+    {
+        return _isCapturing;
+    }
+
+    void reset()
+    {
+        std::lock_guard lock(_threadsMutex);
+        for (auto& buffer : _threads)
+        {
+            buffer->writeCount.store(0, std::memory_order_relaxed);
+            buffer->frameReadCount = 0;
+        }
+        _lastFrameStats = {};
+        _lastFrameEnd = toNanoseconds(Clock::now());
+    }
+
+    // Returns the range of events that are still held in the ring buffer.
+    static std::pair<uint64_t, uint64_t> getRetainedRange(const ThreadBuffer& buffer, uint64_t from)
+    {
+        const auto writeCount = buffer.writeCount.load(std::memory_order_acquire);
+        const auto oldest = writeCount > kEventsPerThread ? writeCount - kEventsPerThread : 0;
+        return { std::max(from, oldest), writeCount };
+    }
+
+    void endFrame()
+    {
+        const auto frameEnd = toNanoseconds(Clock::now());
+
+        FrameStats stats{};
+        stats.frameMs = (frameEnd - _lastFrameEnd) / 1'000'000.0;
+
+        // Zones are keyed by name and depth, first occurrence order keeps parents above children.
+        struct Entry
+        {
+            ZoneStats stats;
+            int64_t firstStart;
+            uint64_t threadMask;
+        };
+        std::vector<Entry> entries;
+
+        {
+            std::lock_guard lock(_threadsMutex);
+            for (auto& buffer : _threads)
+            {
+                const auto [begin, end] = getRetainedRange(*buffer, buffer->frameReadCount);
+                for (auto i = begin; i < end; i++)
+                {
+                    const auto& event = buffer->events[i & (kEventsPerThread - 1)];
+                    const auto durationMs = (event.end - event.start) / 1'000'000.0;
+
+                    auto it = std::find_if(entries.begin(), entries.end(), [&event](const Entry& e) {
+                        return e.stats.name == event.name && e.stats.depth == event.depth;
+                    });
+                    if (it == entries.end())
+                    {
+                        entries.push_back(Entry{ ZoneStats{ event.name, event.depth, 0, 0, 0.0, 0.0 }, event.start, 0 });
+                        it = entries.end() - 1;
+                    }
+
+                    it->stats.calls++;
+                    it->stats.totalMs += durationMs;
+                    it->stats.maxMs = std::max(it->stats.maxMs, durationMs);
+                    it->firstStart = std::min(it->firstStart, event.start);
+                    it->threadMask |= uint64_t{ 1 } << (buffer->threadIndex % 64);
+                }
+                buffer->frameReadCount = end;
+            }
+        }
+
+        std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+            return a.firstStart < b.firstStart;
+        });
+
+        stats.zones.reserve(entries.size());
+        for (auto& entry : entries)
+        {
+            entry.stats.threads = static_cast<uint32_t>(std::popcount(entry.threadMask));
+            stats.zones.push_back(entry.stats);
+        }
+
+        _lastFrameStats = std::move(stats);
+        _lastFrameEnd = frameEnd;
+    }
+
+    const FrameStats& getLastFrameStats()
+    {
+        return _lastFrameStats;
+    }
+
+    static uint64_t getDroppedEventCountLocked()
+    {
+        uint64_t dropped = 0;
+        for (auto& buffer : _threads)
+        {
+            const auto [begin, end] = getRetainedRange(*buffer, 0);
+            dropped += begin;
+        }
+        return dropped;
+    }
+
+    uint64_t getDroppedEventCount()
+    {
+        std::lock_guard lock(_threadsMutex);
+        return getDroppedEventCountLocked();
+    }
+
+    std::string getChromeTrace()
+    {
+        std::string out = "{\"traceEvents\":[\n";
+        bool first = true;
+
+        std::lock_guard lock(_threadsMutex);
+        for (auto& buffer : _threads)
+        {
+            const auto [begin, end] = getRetainedRange(*buffer, 0);
+            for (auto i = begin; i < end; i++)
+            {
+                const auto& event = buffer->events[i & (kEventsPerThread - 1)];
+                if (!first)
+                {
+                    out += ",\n";
+                }
+                first = false;
+
+                // Chrome trace timestamps are in microseconds.
+                fmt::format_to(
+                    std::back_inserter(out),
+                    R"({{"name":"{}","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+                    event.name,
+                    buffer->threadIndex,
+                    event.start / 1000.0,
+                    (event.end - event.start) / 1000.0);
+            }
+        }
+
+        fmt::format_to(std::back_inserter(out), "\n],\"otherData\":{{\"droppedEvents\":{}}}}}\n", getDroppedEventCountLocked());
+        return out;
+    }
+
+    bool exportChromeTrace(const fs::path& path)
+    {
+        std::ofstream stream(path, std::ios::out | std::ios::binary);
+        if (!stream.is_open())
+        {
+            return false;
+        }
+        stream << getChromeTrace();
+
+        const auto dropped = getDroppedEventCount();
+        if (dropped != 0)
+        {
+            Logging::warn("Profiler trace is missing the {} oldest events, only the last {} per thread are kept.", dropped, kEventsPerThread);
+        }
+        return stream.good();
+    }
+}
@@ -0,0 +1,150 @@
+#include <OpenLoco/Diagnostics/Profiler.h>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace OpenLoco::Diagnostics;
+
+class ProfilerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Profiler::setEnabled(true);
+        Profiler::reset();
+    }
+
+    void TearDown() override
+    {
+        Profiler::setEnabled(false);
+        Profiler::reset();
+    }
+
+    static const Profiler::ZoneStats* findZone(const Profiler::FrameStats& stats, std::string_view name)
+    {
+        auto it = std::find_if(stats.zones.begin(), stats.zones.end(), [name](const auto& zone) {
+            return zone.name == name;
+        });
+        return it != stats.zones.end() ? &*it : nullptr;
+    }
+};
+
+TEST_F(ProfilerTest, DisabledRecordsNothing)
+{
+    Profiler::setEnabled(false);
+    {
+        OPENLOCO_PROFILE_ZONE("Disabled");
+    }
+    Profiler::endFrame();
+
+    EXPECT_TRUE(Profiler::getLastFrameStats().zones.empty());
+}
+
+TEST_F(ProfilerTest, NestedZonesHaveDepth)
+{
+    {
+        OPENLOCO_PROFILE_ZONE("Outer");
+        for (int i = 0; i < 3; i++)
+        {
+            OPENLOCO_PROFILE_ZONE("Inner");
+        }
+    }
+    Profiler::endFrame();
+
+    const auto& stats = Profiler::getLastFrameStats();
+    ASSERT_EQ(stats.zones.size(), 2u);
+
+    // Parents are listed before their children.
+    EXPECT_STREQ(stats.zones[0].name, "Outer");
+    EXPECT_EQ(stats.zones[0].depth, 0u);
+    EXPECT_EQ(stats.zones[0].calls, 1u);
+
+    EXPECT_STREQ(stats.zones[1].name, "Inner");
+    EXPECT_EQ(stats.zones[1].depth, 1u);
+    EXPECT_EQ(stats.zones[1].calls, 3u);
+    EXPECT_LE(stats.zones[1].totalMs, stats.zones[0].totalMs);
+}
+
+TEST_F(ProfilerTest, EndFrameOnlyReportsNewZones)
+{
+    {
+        OPENLOCO_PROFILE_ZONE("FirstFrame");
+    }
+    Profiler::endFrame();
+    ASSERT_NE(findZone(Profiler::getLastFrameStats(), "FirstFrame"), nullptr);
+
+    {
+        OPENLOCO_PROFILE_ZONE("SecondFrame");
+    }
+    Profiler::endFrame();
+    EXPECT_EQ(findZone(Profiler::getLastFrameStats(), "FirstFrame"), nullptr);
+    EXPECT_NE(findZone(Profiler::getLastFrameStats(), "SecondFrame"), nullptr);
+}
+
+TEST_F(ProfilerTest, ZonesFromWorkerThreadsAreMerged)
+{
+    std::vector<std::thread> workers;
+    for (int i = 0; i < 4; i++)
+    {
+        workers.emplace_back([] {
+            OPENLOCO_PROFILE_ZONE("Worker");
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    Profiler::endFrame();
+
+    const auto* zone = findZone(Profiler::getLastFrameStats(), "Worker");
+    ASSERT_NE(zone, nullptr);
+    EXPECT_EQ(zone->calls, 4u);
+    EXPECT_EQ(zone->threads, 4u);
+}
+
+TEST_F(ProfilerTest, ChromeTraceContainsCompleteEvents)
+{
+    {
+        OPENLOCO_PROFILE_ZONE("Traced");
+    }
+
+    const auto trace = Profiler::getChromeTrace();
+    EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(trace.find(R"("name":"Traced","ph":"X")"), std::string::npos);
+}
+
+TEST_F(ProfilerTest, ChromeTraceReportsDroppedEvents)
+{
+    EXPECT_EQ(Profiler::getDroppedEventCount(), 0u);
+    EXPECT_NE(Profiler::getChromeTrace().find(R"("otherData":{"droppedEvents":0})"), std::string::npos);
+
+    for (size_t i = 0; i < Profiler::kEventsPerThread + 10; i++)
+    {
+        OPENLOCO_PROFILE_ZONE("Overflow");
+    }
+    EXPECT_EQ(Profiler::getDroppedEventCount(), 10u);
+    EXPECT_NE(Profiler::getChromeTrace().find(R"("otherData":{"droppedEvents":10})"), std::string::npos);
+}
+
+TEST_F(ProfilerTest, CaptureKeepsEventsForExport)
+{
+    {
+        OPENLOCO_PROFILE_ZONE("BeforeCapture");
+    }
+
+    Profiler::setEnabled(false);
+    Profiler::beginCapture();
+    EXPECT_TRUE(Profiler::isCapturing());
+    EXPECT_TRUE(Profiler::isEnabled());
+    {
+        OPENLOCO_PROFILE_ZONE("Captured");
+    }
+    Profiler::endFrame();
+    Profiler::endCapture();
+    EXPECT_FALSE(Profiler::isCapturing());
+    EXPECT_FALSE(Profiler::isEnabled());
+
+    const auto trace = Profiler::getChromeTrace();
+    EXPECT_NE(trace.find(R"("name":"Captured")"), std::string::npos);
+    EXPECT_EQ(trace.find(R"("name":"BeforeCapture")"), std::string::npos);
+}
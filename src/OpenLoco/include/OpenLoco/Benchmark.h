@@ -0,0 +1,40 @@
+#pragma once
+
+#include <OpenLoco/Core/FileSystem.hpp>
+#include <cstdint>
+#include <string>
+
+namespace OpenLoco::Benchmark
+{
+    // The individual stages of GameScene::tick, in the order they run.
+    enum class TickStage : uint8_t
+    {
+        network,
+        defragment,
+        date,
+        tileManager,
+        waveManager,
+        townManager,
+        industryManager,
+        vehicleManager,
+        stationManager,
+        effectsManager,
+        companyManager,
+        animationManager,
+        audio,
+        other,
+    };
+
+    constexpr size_t kTickStageCount = static_cast<size_t>(TickStage::other) + 1;
+
+    bool isRecording();
+    void startRecording(uint32_t expectedTicks);
+    void stopRecording();
+
+    void beginTick();
+    void endStage(TickStage stage);
+    void endTick();
+
+    std::string getReportJson(const fs::path& savePath);
+    void logReport();
+}
@@ -14,6 +14,7 @@ namespace OpenLoco
         join,
         uncompress,
         simulate,
+        bench,
         compare,
         help,
         version,
@@ -28,6 +29,7 @@ namespace OpenLoco
         std::string path2;
         std::optional<int32_t> ticks;
         std::string outputPath;
+        std::string tracePath;
         std::string bind;
         std::optional<uint16_t> port{};
         std::string logLevels;
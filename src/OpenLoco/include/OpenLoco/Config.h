@@ -160,6 +160,7 @@ namespace OpenLoco::Config
 
         float scaleFactor = 1.0f;
         bool showFPS = false;
+        bool showProfiler = false;
         bool uncapFPS = false;
 
         int32_t constructionMarker;
@@ -204,6 +205,8 @@ namespace OpenLoco::Config
         bool disableStationSizeLimit = false;
         bool showAiPlanningAsGhosts = false;
         bool keepCargoModifyPickup = false;
+        // Experimental, changes how road vehicles choose routes so must match between networked players
+        bool roadAStarPathing = false;
 
         bool usePreferredOwnerName = false;
         std::string preferredOwnerName;
@@ -1,10 +1,13 @@
 #pragma once
 
+#include "Engine/Limits.h"
 #include "Entity.h"
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Engine/World.hpp>
+#include <array>
 #include <cstdio>
 #include <iterator>
+#include <type_traits>
 
 namespace OpenLoco::Vehicles
 {
@@ -45,6 +48,52 @@ namespace OpenLoco::EntityManager
     void updateSpatialIndex();
     void moveSpatialEntry(EntityBase& entity, const World::Pos3& loc);
 
+    // Packed copy of each entity's spatial index link and position, 8 bytes per entity instead
+    // of the whole entity, so proximity checks can filter by position before resolving entities.
+    struct SpatialNode
+    {
+        EntityId nextQuadrantId;
+        World::Pos3 position;
+    };
+
+    namespace Detail
+    {
+        extern std::array<SpatialNode, Limits::kMaxEntities> _spatialNodes;
+
+        // Returns false if the callback asked to stop.
+        template<typename TFunc>
+        bool invokeSpatialCallback(TFunc& func, EntityId id, const World::Pos3& position)
+        {
+            if constexpr (std::is_same_v<std::invoke_result_t<TFunc&, EntityId, const World::Pos3&>, bool>)
+            {
+                return func(id, position);
+            }
+            else
+            {
+                func(id, position);
+                return true;
+            }
+        }
+    }
+
+    // Calls func(EntityId, const World::Pos3&) for every entity on the tile, in the same order as
+    // EntityTileList. The callback may return false to stop early, in which case false is returned.
+    template<typename TFunc>
+    bool forEachEntityOnTile(const World::TilePos2& pos, TFunc&& func)
+    {
+        auto id = firstQuadrantId(World::toWorldSpace(pos));
+        while (enumValue(id) < Limits::kMaxEntities)
+        {
+            const auto& node = Detail::_spatialNodes[enumValue(id)];
+            if (!Detail::invokeSpatialCallback(func, id, node.position))
+            {
+                return false;
+            }
+            id = node.nextQuadrantId;
+        }
+        return true;
+    }
+
     EntityBase* createEntityMisc();
     EntityBase* createEntityMoney();
     EntityBase* createEntityVehicle();
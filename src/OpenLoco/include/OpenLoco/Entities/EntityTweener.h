@@ -2,15 +2,23 @@
 
 #include "EntityManager.h"
 #include <OpenLoco/Engine/World.hpp>
+#include <cstdint>
 #include <vector>
 
 namespace OpenLoco
 {
     class EntityTweener
     {
+        // Tweened entities and their positions are kept as parallel arrays so that
+        // the interpolation in tween runs over plain contiguous coordinates.
         std::vector<EntityBase*> _entities;
-        std::vector<World::Pos3> _prePos;
-        std::vector<World::Pos3> _postPos;
+        std::vector<int16_t> _preX, _preY, _preZ;
+        std::vector<int16_t> _postX, _postY, _postZ;
+        std::vector<int16_t> _tweenX, _tweenY, _tweenZ;
+        // Index into the arrays above for each EntityId, kNoSlot when not tweened.
+        std::vector<uint32_t> _slots;
+
+        void addEntity(EntityBase* entity);
 
     public:
         static EntityTweener& get();
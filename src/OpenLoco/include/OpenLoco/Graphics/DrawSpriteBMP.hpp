@@ -77,6 +77,19 @@ namespace OpenLoco::Gfx
                 noiseMask = nextNoiseMask;
             }
         }
+        else if constexpr (TBlendOp == DrawBlendOp::transparent && TZoomLevel == 0)
+        {
+            if (width <= 0)
+            {
+                return;
+            }
+            for (; height > 0; height--)
+            {
+                blitRowTransparent(src, dst, static_cast<size_t>(width));
+                src += srcLineWidth;
+                dst += dstLineWidth;
+            }
+        }
         else
         {
             for (; height > 0; height -= zoom)
@@ -82,4 +82,15 @@ namespace OpenLoco::Gfx
             return true;
         }
     }
+
+    // Same result as blitPixel<DrawBlendOp::transparent> for each pixel but as a select instead
+    // of an early out, which lets the compiler vectorise the row. Blend ops with a palette lookup
+    // or a zoom level above 0 measured faster with blitPixel so only this one is done by row.
+    inline void blitRowTransparent(const uint8_t* src, uint8_t* dst, const size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            dst[i] = src[i] != PaletteIndex::transparent ? src[i] : dst[i];
+        }
+    }
 }
@@ -81,6 +81,63 @@ namespace OpenLoco::Gfx
                 }
             }
         }
+
+        // Calls func once for every run of rows containing dirty blocks, with the columns spanning
+        // all dirty blocks of those rows. Gives fewer and larger regions than traverseDirtyCells.
+        template<typename F>
+        void traverseDirtyRows(F&& func)
+        {
+            const auto columnCount = _columnCount;
+            const auto rowCount = _rowCount;
+            auto& blocks = _blocks;
+
+            uint32_t row = 0;
+            while (row < rowCount)
+            {
+                auto firstColumn = columnCount;
+                uint32_t lastColumn = 0;
+                const auto firstRow = row;
+                for (; row < rowCount; row++)
+                {
+                    auto* rowBlocks = blocks.data() + row * columnCount;
+                    uint32_t first = 0;
+                    while (first < columnCount && rowBlocks[first] == 0)
+                    {
+                        first++;
+                    }
+                    if (first == columnCount)
+                    {
+                        break;
+                    }
+                    uint32_t last = columnCount - 1;
+                    while (rowBlocks[last] == 0)
+                    {
+                        last--;
+                    }
+                    firstColumn = std::min(firstColumn, first);
+                    lastColumn = std::max(lastColumn, last);
+                    std::fill(rowBlocks, rowBlocks + columnCount, 0);
+                }
+
+                if (row == firstRow)
+                {
+                    // Row is clean
+                    row++;
+                    continue;
+                }
+
+                // Convert to pixel coordinates.
+                const auto left = firstColumn * _blockWidth;
+                const auto top = firstRow * _blockHeight;
+                const auto right = (lastColumn + 1) * _blockWidth;
+                const auto bottom = row * _blockHeight;
+
+                if (left < _screenWidth && top < _screenHeight)
+                {
+                    func(left, top, std::min(right, _screenWidth), std::min(bottom, _screenHeight));
+                }
+            }
+        }
     };
 
 } // namespace OpenRCT2
@@ -0,0 +1,8 @@
+#pragma once
+
+namespace OpenLoco::Gfx
+{
+    class DrawingContext;
+
+    void drawProfilerOverlay(DrawingContext& drawingCtx);
+}
@@ -6,7 +6,9 @@
 #include <OpenLoco/Engine/Ui/Rect.hpp>
 #include <SDL3/SDL_pixels.h>
 #include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 
 struct SDL_Palette;
@@ -70,6 +72,9 @@ namespace OpenLoco::Gfx
 
     private:
         void renderDirtyRegions();
+        void updatePaletteLUT(int32_t index, int32_t count);
+        bool blitAndUploadScreen();
+        void convertAndUploadRegion(int32_t left, int32_t top, int32_t right, int32_t bottom);
 
         SDL_Renderer* _renderer{};
         SDL_Window* _window{};
@@ -84,6 +89,12 @@ namespace OpenLoco::Gfx
 
         SoftwareDrawingContext _ctx;
         InvalidationGrid _invalidationGrid;
+        // Regions that changed since the last present, only those are converted and uploaded.
+        InvalidationGrid _presentGrid;
+
+        // Palette index to output pixel, only used when the output format is 32 bits per pixel.
+        std::array<uint32_t, 256> _paletteLUT{};
+        bool _isFullPresentRequired = true;
 
         bool _vsync = false;
     };
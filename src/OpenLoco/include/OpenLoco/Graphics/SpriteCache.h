@@ -0,0 +1,43 @@
+#pragma once
+
+#include <OpenLoco/Engine/Ui/Point.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace OpenLoco::Gfx
+{
+    struct G1Element;
+}
+
+namespace OpenLoco::Gfx::SpriteCache
+{
+    struct Stats
+    {
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t evictions;
+        size_t entries;
+        size_t memoryUsage;
+        size_t memoryBudget;
+    };
+
+    // Every thread drawing sprites has its own cache. Returned images belong to the cache of the
+    // calling thread and stay valid until that thread next calls into the cache.
+
+    // Returns an RLE image made of every (1 << zoomLevel)th pixel of every (1 << zoomLevel)th
+    // line of the RLE image, starting at phase. Drawing it at zoom level 0 gives the same
+    // result as drawing the source image at zoomLevel. Returns nullptr if the image can
+    // not be cached.
+    const G1Element* getDecimatedRLE(const G1Element& element, uint8_t zoomLevel, Ui::Point phase);
+
+    // Returns the RLE image decoded to a bitmap with transparent pixels where there are no runs.
+    // Returns nullptr if the image can not be cached.
+    const G1Element* getDecodedRLE(const G1Element& element);
+
+    // Must be called when image data is replaced, entries are keyed on the image data address.
+    // Can be called from any thread, each cache is cleared on its next use.
+    void invalidate();
+
+    // Totals of all threads
+    Stats getStats();
+}
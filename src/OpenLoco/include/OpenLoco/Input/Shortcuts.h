@@ -66,6 +66,8 @@ namespace OpenLoco::Input
         gameSpeedFastForward,
         gameSpeedExtraFastForward,
         openDebugWindow,
+        toggleProfilerOverlay,
+        exportProfilerTrace,
     };
 
     constexpr uint32_t kInvalidKeyCode = 0xFFFFFFFF;
@@ -2175,6 +2175,11 @@ namespace OpenLoco::StringIds
     constexpr StringId shortcut_debug_window = 2459;
     constexpr StringId toolbar_auto_menu = 2460;
     constexpr StringId toolbar_buttons_centred = 2461;
+    constexpr StringId shortcut_toggle_profiler_overlay = 2462;
+    constexpr StringId shortcut_export_profiler_trace = 2463;
+    constexpr StringId profiler_trace_saved_as = 2464;
+    constexpr StringId profiler_trace_failed = 2465;
+    constexpr StringId profiler_trace_capture_started = 2466;
 
     constexpr StringId temporary_object_load_str_0 = 8192;
     constexpr StringId temporary_object_load_str_1 = 8193;
@@ -40,10 +40,23 @@ namespace OpenLoco::World::TileManager
     };
     OPENLOCO_ENABLE_ENUM_OPERATORS(ElementPositionFlags);
 
+    struct FragmentationStats
+    {
+        uint32_t entriesEnd;
+        uint32_t freeRuns;
+        uint32_t freeEntries; // Empty entries below entriesEnd
+        uint32_t largestFreeRun;
+    };
+
     void allocateMapElements();
     void initialise();
     std::span<const TileElementEntry> getEntries();
     uint32_t numFreeElements();
+    // Free elements as the original allocator counted them, which moved every tile it inserted
+    // into to the end. Space is only given back when the elements are packed by a load or reorganise.
+    uint32_t numFreeElementsAppendOnly();
+    // Debug information about the holes left between tiles in the element array
+    FragmentationStats getFragmentationStats();
     Tile get(TilePos2 pos);
     Tile get(Pos2 pos);
     Tile get(coord_t x, coord_t y);
@@ -82,6 +95,9 @@ namespace OpenLoco::World::TileManager
     void disablePeriodicDefrag();
     // Fully defragment the tile element array
     void reorganise();
+    // Reorganises and lays out the element stores in tile order. This moves every element, so
+    // it must only be called while no element references are held, such as when saving.
+    void repackElementStores();
     // Defragments singular tile (chosen tile updates each call)
     void defragmentTilePeriodic();
     bool checkFreeElementsAndReorganise();
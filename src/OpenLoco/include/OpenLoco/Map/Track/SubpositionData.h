@@ -2,7 +2,11 @@
 
 #include "Types.hpp"
 #include <OpenLoco/Engine/World.hpp>
+#include <array>
+#include <cstddef>
 #include <span>
+#include <stdexcept>
+#include <utility>
 
 namespace OpenLoco
 {
@@ -16,10 +20,77 @@ namespace OpenLoco::World::TrackData
         World::Pos3 loc; // 0x00
         uint8_t yaw;     // 0x06
         Pitch pitch;     // 0x07
+
+        constexpr bool operator==(const MoveInfo&) const = default;
     };
     static_assert(sizeof(MoveInfo) == 0x8);
 
-    std::span<const MoveInfo> getTrackSubPositon(const uint16_t trackAndDirection);
-    std::span<const MoveInfo> getRoadSubPositon(const uint16_t trackAndDirection);
-    std::span<const MoveInfo> getRoadPlacementSubPositon(const uint16_t trackAndDirection);
+    // MoveInfo packed into 32 bits. Every vehicle component reads these tables every tick so halving
+    // their size keeps far more of them in cache. Bits: x 0-7, y 8-15, z 16-21, yaw 22-27, pitch 28-31.
+    class PackedMoveInfo
+    {
+        static constexpr int32_t kXYBias = 64;
+        static constexpr int32_t kZBias = 32;
+
+        uint32_t _data;
+
+    public:
+        constexpr PackedMoveInfo(const MoveInfo& info)
+            : _data(0)
+        {
+            const auto x = info.loc.x + kXYBias;
+            const auto y = info.loc.y + kXYBias;
+            const auto z = info.loc.z + kZBias;
+            const auto pitch = static_cast<uint8_t>(info.pitch);
+            if (x < 0 || x > 0xFF || y < 0 || y > 0xFF || z < 0 || z > 0x3F || info.yaw > 0x3F || pitch > 0xF)
+            {
+                throw std::out_of_range("MoveInfo can not be packed");
+            }
+            _data = static_cast<uint32_t>(x) | (static_cast<uint32_t>(y) << 8) | (static_cast<uint32_t>(z) << 16)
+                | (static_cast<uint32_t>(info.yaw) << 22) | (static_cast<uint32_t>(pitch) << 28);
+        }
+
+        constexpr MoveInfo unpack() const
+        {
+            const auto x = static_cast<coord_t>(static_cast<int32_t>(_data & 0xFF) - kXYBias);
+            const auto y = static_cast<coord_t>(static_cast<int32_t>((_data >> 8) & 0xFF) - kXYBias);
+            const auto z = static_cast<coord_t>(static_cast<int32_t>((_data >> 16) & 0x3F) - kZBias);
+            return MoveInfo{ World::Pos3{ x, y, z }, static_cast<uint8_t>((_data >> 22) & 0x3F), static_cast<Pitch>(_data >> 28) };
+        }
+    };
+    static_assert(sizeof(PackedMoveInfo) == 0x4);
+
+    template<size_t TSize>
+    constexpr std::array<PackedMoveInfo, TSize> packMoveInfo(const std::array<MoveInfo, TSize>& moveInfo)
+    {
+        return [&moveInfo]<size_t... I>(std::index_sequence<I...>) {
+            return std::array<PackedMoveInfo, TSize>{ PackedMoveInfo(moveInfo[I])... };
+        }(std::make_index_sequence<TSize>{});
+    }
+
+    // Read only view of a packed table, entries are unpacked on access
+    class MoveInfoSpan
+    {
+        std::span<const PackedMoveInfo> _data;
+
+    public:
+        constexpr MoveInfoSpan(std::span<const PackedMoveInfo> data)
+            : _data(data)
+        {
+        }
+
+        constexpr size_t size() const
+        {
+            return _data.size();
+        }
+
+        constexpr MoveInfo operator[](size_t index) const
+        {
+            return _data[index].unpack();
+        }
+    };
+
+    MoveInfoSpan getTrackSubPositon(const uint16_t trackAndDirection);
+    MoveInfoSpan getRoadSubPositon(const uint16_t trackAndDirection);
+    MoveInfoSpan getRoadPlacementSubPositon(const uint16_t trackAndDirection);
 }
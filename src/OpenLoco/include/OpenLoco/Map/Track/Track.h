@@ -68,5 +68,9 @@ namespace OpenLoco::World::Track
     // queryMods sets AdditionalTaDFlags::hasMods of connection if connection has the queryMods
     TrackConnections getTrackConnections(const World::Pos3& nextTrackPos, const uint8_t nextRotation, const CompanyId company, const uint8_t trackObjectId, const uint8_t requiredMods, const uint8_t queryMods);
     TrackConnections getTrackConnectionsAi(const World::Pos3& nextTrackPos, const uint8_t nextRotation, const CompanyId company, const uint8_t trackObjectId, const uint8_t requiredMods, const uint8_t queryMods);
+    // Must be called whenever track, signal, road or station elements are added, removed or modified
+    void invalidateTrackNetwork();
+    // Changes every time invalidateTrackNetwork is called, for caches derived from the track network
+    uint32_t getTrackNetworkRevision();
     ConnectionEnd getTrackConnectionEnd(const World::Pos3& pos, const uint16_t trackAndDirection);
 }
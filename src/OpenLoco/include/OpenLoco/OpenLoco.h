@@ -20,6 +20,7 @@ namespace OpenLoco
     void* hInstance();
     void resetSubsystems();
     void simulateGame(const fs::path& path, int32_t ticks);
+    bool benchmarkGame(const fs::path& path, int32_t ticks, const fs::path& reportPath, const fs::path& tracePath);
 
     void initialise();
     void update();
@@ -9,8 +9,9 @@
 #include <OpenLoco/Engine/World.hpp>
 #include <OpenLoco/ZoomLevel.hpp>
 #include <array>
-#include <sfl/segmented_vector.hpp>
+#include <memory>
 #include <span>
+#include <vector>
 
 namespace OpenLoco::World
 {
@@ -231,10 +232,63 @@ namespace OpenLoco::Paint
 
     static constexpr auto kMaxPaintQuadrants = 1024;
 
+    union PaintEntry
+    {
+        PaintStruct basic;
+        AttachedPaintStruct attached;
+        PaintStringStruct string;
+
+        PaintEntry() {}
+    };
+
+    // Storage for the paint structs and quadrant lists of a session. Arenas belong to a thread
+    // and are reset rather than freed when a session ends, so painting only allocates while an
+    // arena grows to fit the busiest column its thread has painted.
+    class PaintArena
+    {
+    public:
+        static constexpr size_t kChunkSize = 256;
+
+        // Quadrant lists are all empty whenever the arena is not in use
+        std::array<PaintStruct*, kMaxPaintQuadrants> quadrants{};
+
+        PaintEntry& allocate()
+        {
+            const auto chunk = _size / kChunkSize;
+            if (chunk == _chunks.size())
+            {
+                addChunk();
+            }
+            auto& entry = _chunks[chunk][_size % kChunkSize];
+            _size++;
+            return entry;
+        }
+
+        void reset() { _size = 0; }
+
+    private:
+        std::vector<std::unique_ptr<PaintEntry[]>> _chunks;
+        size_t _size = 0;
+
+        void addChunk();
+    };
+
+    struct PaintArenaStats
+    {
+        uint64_t heapAllocations; // Total since startup
+        size_t reservedBytes;
+    };
+
+    PaintArenaStats getPaintArenaStats();
+
     struct PaintSession
     {
     public:
         PaintSession(const Gfx::RenderTarget& rt, ZoomLevel zoom, const SessionOptions& options);
+        ~PaintSession();
+
+        PaintSession(const PaintSession&) = delete;
+        PaintSession& operator=(const PaintSession&) = delete;
 
         void generate();
         void arrangeStructs();
@@ -439,16 +493,7 @@ namespace OpenLoco::Paint
         void generateTilesAndEntities(GenerationParameters&& p);
         void finaliseOrdering(std::span<PaintStruct*> paintStructs);
 
-        union PaintEntry
-        {
-            PaintStruct basic;
-            AttachedPaintStruct attached;
-            PaintStringStruct string;
-
-            PaintEntry() {}
-        };
-
-        sfl::segmented_vector<PaintEntry, 128> _paintEntries;
+        PaintArena& _arena;
 
         const Gfx::RenderTarget* _renderTarget{};
         ZoomLevel _zoom{};
@@ -469,7 +514,7 @@ namespace OpenLoco::Paint
         void* _currentItem{};
         uint8_t currentRotation{}; // new field set from 0x00E3F0B8 but split out into this struct as separate item
         Ui::ViewportFlags _viewFlags{};
-        std::array<PaintStruct*, kMaxPaintQuadrants> _quadrants;
+        std::array<PaintStruct*, kMaxPaintQuadrants>& _quadrants;
         uint32_t _quadrantBackIndex;
         uint32_t _quadrantFrontIndex;
         std::array<PaintStruct*, 5> _trackRoadPaintStructs;
@@ -527,7 +572,7 @@ namespace OpenLoco::Paint
         {
             static_assert(std::same_as<T, PaintStruct> || std::same_as<T, AttachedPaintStruct> || std::same_as<T, PaintStringStruct>);
 
-            auto& ps = _paintEntries.emplace_back();
+            auto& ps = _arena.allocate();
 
             auto* specificPs = reinterpret_cast<T*>(&ps);
             *specificPs = {}; // Zero out the struct
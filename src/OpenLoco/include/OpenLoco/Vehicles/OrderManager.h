@@ -117,16 +117,26 @@ namespace OpenLoco::Vehicles::OrderManager
     Order* orders();
     uint32_t& orderTableLength();
 
-    void shiftOrdersLeft(const uint32_t offsetToShiftTowards, const int16_t sizeToShiftBy);
-    void shiftOrdersRight(const uint32_t offsetToShiftFrom, const int16_t sizeToShiftBy);
-    void reoffsetVehicleOrderTables(const uint32_t removeOrderTableOffset, const int16_t sizeOfRemovedOrderTable);
-
     bool spaceLeftInGlobalOrderTableForOrder(const Order* order);
     bool spaceLeftInVehicleOrderTable(VehicleHead* head);
     void insertOrder(VehicleHead* head, uint16_t orderOffset, const Order* order);
 
     void deleteOrder(VehicleHead* head, uint16_t orderOffset);
     void zeroUnusedOrderTable();
+    void exportOrderTable();
+    void importOrderTable();
+
+    // Exports the order tables and imports them back into the pool when going out of scope, so the
+    // vehicles point into the pool again however saving ends.
+    class ScopedOrderTableExport
+    {
+    public:
+        ScopedOrderTableExport();
+        ~ScopedOrderTableExport();
+
+        ScopedOrderTableExport(const ScopedOrderTableExport&) = delete;
+        ScopedOrderTableExport& operator=(const ScopedOrderTableExport&) = delete;
+    };
     void reset();
     void freeOrders(VehicleHead* const head);
     void allocateOrders(VehicleHead& head);
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <OpenLoco/Engine/World.hpp>
+#include <array>
+#include <compare>
+#include <cstdint>
+
+namespace OpenLoco::Vehicles
+{
+    struct NearbyBoats
+    {
+        std::array<std::array<bool, 16>, 16> searchResult; // 0x00525BEC
+        World::TilePos2 startTile;                         // 0x00525BE8
+    };
+
+    struct PathFindingResult
+    {
+        uint16_t bestScore;
+        uint8_t cost;
+
+        constexpr auto operator<=>(const PathFindingResult& rhs) const = default;
+    };
+
+    // Whether a boat can sail through a tile. The four searches started by waterPathfind overlap
+    // heavily so each tile is only resolved once per pathfind.
+    class WaterPassabilityCache
+    {
+        // One step to the first tile of each search and 7 more within it
+        static constexpr int32_t kRadius = 8;
+        static constexpr int32_t kSize = kRadius * 2 + 1;
+
+        enum class State : uint8_t
+        {
+            unknown,
+            passable,
+            blocked,
+        };
+
+        World::TilePos2 _origin;
+        World::MicroZ _waterMicroZ;
+        const NearbyBoats& _nearbyVehicles;
+        std::array<State, kSize * kSize> _states{};
+
+        bool resolve(const World::TilePos2 tilePos) const;
+
+    public:
+        WaterPassabilityCache(const World::TilePos2 origin, const World::MicroZ waterMicroZ, const NearbyBoats& nearbyVehicles)
+            : _origin(origin)
+            , _waterMicroZ(waterMicroZ)
+            , _nearbyVehicles(nearbyVehicles)
+        {
+        }
+
+        bool isPassable(const World::TilePos2 tilePos);
+    };
+
+    // Best score towards the target of the tiles a boat can reach within 7 steps of startPos
+    PathFindingResult waterPathfindToTarget(const World::TilePos2 startPos, const World::TilePos2 targetOrderPos, WaterPassabilityCache& passability);
+}
@@ -204,6 +204,9 @@ namespace OpenLoco::Ui
         int32_t savedViewY;            // 0x4
     };
 
+    // Must be called whenever the label frame of a station or town changes.
+    void invalidateLabelIndex();
+
     namespace WindowToViewport
     {
         [[nodiscard]] constexpr Point windowOffsetTransform(const Point& uiPoint, const Viewport& vp)
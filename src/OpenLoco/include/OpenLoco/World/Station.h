@@ -165,6 +165,12 @@ namespace OpenLoco
 
     void setCatchmentDisplay(const Station* station, const CatchmentFlags flags);
     bool isWithinCatchmentDisplay(const World::Pos2 pos);
+
+    // Cargo acceptance and production of building and industry elements is cached per tile.
+    // Must be called whenever such an element is added to, removed from or finishes construction on a tile.
+    void invalidateCargoContribution(const World::TilePos2& pos);
+    void resetCargoContributions();
+
     struct PotentialCargo
     {
         uint32_t accepted;
@@ -26,6 +26,11 @@ namespace OpenLoco::StationManager
     StationId allocateNewStation(const World::Pos3 pos, const CompanyId owner, const uint8_t mode);
     void deallocateStation(const StationId stationId);
 
+    // Coarse grid of map cells to the stations whose registered tiles are near them, must be
+    // updated whenever the tiles of a station change.
+    void resetSpatialIndex();
+    void updateSpatialIndex(const StationId stationId);
+
     struct NearbyStation
     {
         StationId id;
@@ -0,0 +1,222 @@
+#include "Benchmark.h"
+#include "Logging.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <fmt/format.h>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::Benchmark
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct StageSummary
+    {
+        double totalMs;
+        double meanUs;
+        double p50Us;
+        double p90Us;
+        double p99Us;
+        double maxUs;
+    };
+
+    static constexpr std::array<const char*, kTickStageCount> kStageNames = {
+        "network",
+        "defragment",
+        "date",
+        "tileManager",
+        "waveManager",
+        "townManager",
+        "industryManager",
+        "vehicleManager",
+        "stationManager",
+        "effectsManager",
+        "companyManager",
+        "animationManager",
+        "audio",
+        "other",
+    };
+
+    static bool _isRecording = false;
+    static Clock::time_point _recordingStart;
+    static Clock::duration _recordingDuration;
+    static Clock::time_point _tickStart;
+    static Clock::time_point _lastLap;
+
+    // Per tick samples in nanoseconds, one vector per stage.
+    static std::array<std::vector<uint32_t>, kTickStageCount> _stageSamples;
+    static std::array<uint64_t, kTickStageCount> _currentTick;
+    static std::vector<uint32_t> _tickSamples;
+
+    bool isRecording()
+    {
+        return _isRecording;
+    }
+
+    void startRecording(uint32_t expectedTicks)
+    {
+        for (auto& samples : _stageSamples)
+        {
+            samples.clear();
+            samples.reserve(expectedTicks);
+        }
+        _tickSamples.clear();
+        _tickSamples.reserve(expectedTicks);
+
+        _isRecording = true;
+        _recordingStart = Clock::now();
+        _recordingDuration = {};
+    }
+
+    void stopRecording()
+    {
+        if (!_isRecording)
+        {
+            return;
+        }
+        _recordingDuration = Clock::now() - _recordingStart;
+        _isRecording = false;
+    }
+
+    static uint32_t toNanoseconds(Clock::duration duration)
+    {
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        return static_cast<uint32_t>(std::clamp<int64_t>(ns, 0, std::numeric_limits<uint32_t>::max()));
+    }
+
+    void beginTick()
+    {
+        if (!_isRecording)
+        {
+            return;
+        }
+        _currentTick.fill(0);
+        _tickStart = Clock::now();
+        _lastLap = _tickStart;
+    }
+
+    // Attributes the time since the previous lap to the given stage.
+    void endStage(TickStage stage)
+    {
+        if (!_isRecording)
+        {
+            return;
+        }
+        const auto now = Clock::now();
+        _currentTick[static_cast<size_t>(stage)] += toNanoseconds(now - _lastLap);
+        _lastLap = now;
+    }
+
+    void endTick()
+    {
+        if (!_isRecording)
+        {
+            return;
+        }
+        endStage(TickStage::other);
+
+        for (size_t i = 0; i < kTickStageCount; i++)
+        {
+            _stageSamples[i].push_back(static_cast<uint32_t>(_currentTick[i]));
+        }
+        _tickSamples.push_back(toNanoseconds(_lastLap - _tickStart));
+    }
+
+    static StageSummary summarise(const std::vector<uint32_t>& samples)
+    {
+        if (samples.empty())
+        {
+            return {};
+        }
+
+        auto sorted = samples;
+        std::sort(sorted.begin(), sorted.end());
+
+        const auto percentile = [&sorted](double p) {
+            const auto index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+            return sorted[index] / 1000.0;
+        };
+
+        const auto total = std::accumulate(sorted.begin(), sorted.end(), uint64_t{ 0 });
+
+        StageSummary summary{};
+        summary.totalMs = total / 1'000'000.0;
+        summary.meanUs = total / 1000.0 / sorted.size();
+        summary.p50Us = percentile(0.50);
+        summary.p90Us = percentile(0.90);
+        summary.p99Us = percentile(0.99);
+        summary.maxUs = sorted.back() / 1000.0;
+        return summary;
+    }
+
+    static void appendSummaryJson(std::string& out, const char* name, const StageSummary& s)
+    {
+        fmt::format_to(
+            std::back_inserter(out),
+            R"({{ "name": "{}", "totalMs": {:.3f}, "meanUs": {:.3f}, "p50Us": {:.3f}, "p90Us": {:.3f}, "p99Us": {:.3f}, "maxUs": {:.3f} }})",
+            name,
+            s.totalMs,
+            s.meanUs,
+            s.p50Us,
+            s.p90Us,
+            s.p99Us,
+            s.maxUs);
+    }
+
+    static std::string escapeJson(std::string_view str)
+    {
+        std::string result;
+        result.reserve(str.size());
+        for (auto c : str)
+        {
+            if (c == '"' || c == '\\')
+            {
+                result.push_back('\\');
+            }
+            result.push_back(c);
+        }
+        return result;
+    }
+
+    std::string getReportJson(const fs::path& savePath)
+    {
+        const auto wallTimeMs = std::chrono::duration<double, std::milli>(_recordingDuration).count();
+        const auto ticks = _tickSamples.size();
+
+        std::string out;
+        out += "{\n";
+        fmt::format_to(std::back_inserter(out), "  \"path\": \"{}\",\n", escapeJson(savePath.u8string()));
+        fmt::format_to(std::back_inserter(out), "  \"ticks\": {},\n", ticks);
+        fmt::format_to(std::back_inserter(out), "  \"wallTimeMs\": {:.3f},\n", wallTimeMs);
+        fmt::format_to(std::back_inserter(out), "  \"ticksPerSecond\": {:.3f},\n", wallTimeMs > 0 ? ticks * 1000.0 / wallTimeMs : 0.0);
+        out += "  \"tick\": ";
+        appendSummaryJson(out, "tick", summarise(_tickSamples));
+        out += ",\n  \"stages\": [\n";
+        for (size_t i = 0; i < kTickStageCount; i++)
+        {
+            out += "    ";
+            appendSummaryJson(out, kStageNames[i], summarise(_stageSamples[i]));
+            out += i + 1 < kTickStageCount ? ",\n" : "\n";
+        }
+        out += "  ]\n}\n";
+        return out;
+    }
+
+    void logReport()
+    {
+        const auto logSummary = [](const char* name, const StageSummary& s) {
+            Logging::info("  {:<17} {:>10.3f} {:>10.3f} {:>10.3f} {:>10.3f} {:>10.3f}", name, s.totalMs, s.meanUs, s.p50Us, s.p99Us, s.maxUs);
+        };
+
+        Logging::info("  {:<17} {:>10} {:>10} {:>10} {:>10} {:>10}", "stage", "total ms", "mean us", "p50 us", "p99 us", "max us");
+        for (size_t i = 0; i < kTickStageCount; i++)
+        {
+            logSummary(kStageNames[i], summarise(_stageSamples[i]));
+        }
+        logSummary("tick", summarise(_tickSamples));
+    }
+}
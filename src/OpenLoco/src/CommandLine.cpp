@@ -301,6 +301,7 @@ namespace OpenLoco
                           .registerOption("--bind", 1)
                           .registerOption("--port", "-p", 1)
                           .registerOption("-o", 1)
+                          .registerOption("--trace", 1)
                           .registerOption("--help", "-h")
                           .registerOption("--version")
                           .registerOption("--intro")
@@ -352,6 +353,12 @@ namespace OpenLoco
                 options.ticks = parser.getArg<int32_t>(2);
                 options.path2 = parser.getArg(3);
             }
+            else if (firstArg == "bench")
+            {
+                options.action = CommandLineAction::bench;
+                options.path = parser.getArg(1);
+                options.ticks = parser.getArg<int32_t>(2);
+            }
             else if (firstArg == "compare")
             {
                 options.action = CommandLineAction::compare;
@@ -380,6 +387,7 @@ namespace OpenLoco
             options.port = parser.getArg<int32_t>("-p");
         }
         options.outputPath = parser.getArg("-o");
+        options.tracePath = parser.getArg("--trace");
 
         if (parser.hasOption("--log_levels"))
         {
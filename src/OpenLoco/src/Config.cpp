@@ -120,6 +120,7 @@ namespace OpenLoco::Config
         // Display
         _config.scaleFactor = config["scale_factor"].as<float>(1.0f);
         _config.showFPS = config["showFPS"].as<bool>(false);
+        _config.showProfiler = config["showProfiler"].as<bool>(false);
         _config.uncapFPS = config["uncapFPS"].as<bool>(false);
 
         // Rendering
@@ -181,6 +182,7 @@ namespace OpenLoco::Config
         _config.disableStationSizeLimit = config["disableStationSizeLimit"].as<bool>(false);
         _config.showAiPlanningAsGhosts = config["showAiPlanningAsGhosts"].as<bool>(false);
         _config.keepCargoModifyPickup = config["keepCargoModifyPickup"].as<bool>(false);
+        _config.roadAStarPathing = config["roadAStarPathing"].as<bool>(false);
 
         // Preferred owner
         _config.preferredOwnerName = config["preferredOwnerName"].as<std::string>("");
@@ -272,6 +274,7 @@ namespace OpenLoco::Config
         // Display
         node["scale_factor"] = _config.scaleFactor;
         node["showFPS"] = _config.showFPS;
+        node["showProfiler"] = _config.showProfiler;
         node["uncapFPS"] = _config.uncapFPS;
 
         // Rendering
@@ -322,6 +325,7 @@ namespace OpenLoco::Config
         node["disableStationSizeLimit"] = _config.disableStationSizeLimit;
         node["showAiPlanningAsGhosts"] = _config.showAiPlanningAsGhosts;
         node["keepCargoModifyPickup"] = _config.keepCargoModifyPickup;
+        node["roadAStarPathing"] = _config.roadAStarPathing;
 
         // Preferred owner
         node["preferredOwnerName"] = _config.preferredOwnerName;
@@ -20,6 +20,9 @@ namespace OpenLoco::EntityManager
     static EntityId _entitySpatialIndex[kSpatialEntityMapSize]; // 0x01025A8C
     static uint32_t _entitySpatialCount;                        // 0x01025A88
 
+    std::array<SpatialNode, Limits::kMaxEntities> Detail::_spatialNodes;
+    static_assert(sizeof(SpatialNode) == 8);
+
     static auto& rawEntities() { return getGameState().entities; }
     static auto entities() { return FixedVector(rawEntities()); }
     static auto& rawListHeads() { return getGameState().entityListHeads; }
@@ -157,6 +160,7 @@ namespace OpenLoco::EntityManager
     {
         entity.nextQuadrantId = _entitySpatialIndex[newIndex];
         _entitySpatialIndex[newIndex] = entity.id;
+        Detail::_spatialNodes[enumValue(entity.id)] = SpatialNode{ entity.nextQuadrantId, entity.position };
     }
 
     static void insertToSpatialIndex(EntityBase& entity)
@@ -192,6 +196,7 @@ namespace OpenLoco::EntityManager
     static bool removeFromSpatialIndex(EntityBase& entity, const size_t index)
     {
         auto* quadId = &_entitySpatialIndex[index];
+        SpatialNode* quadNode = nullptr;
         _entitySpatialCount = 0;
         while (enumValue(*quadId) < Limits::kMaxEntities)
         {
@@ -199,6 +204,10 @@ namespace OpenLoco::EntityManager
             if (quadEnt == &entity)
             {
                 *quadId = entity.nextQuadrantId;
+                if (quadNode != nullptr)
+                {
+                    quadNode->nextQuadrantId = entity.nextQuadrantId;
+                }
                 return true;
             }
             _entitySpatialCount++;
@@ -207,6 +216,7 @@ namespace OpenLoco::EntityManager
                 break;
             }
             quadId = &quadEnt->nextQuadrantId;
+            quadNode = &Detail::_spatialNodes[enumValue(quadEnt->id)];
         }
         return false;
     }
@@ -232,6 +242,7 @@ namespace OpenLoco::EntityManager
             }
             insertToSpatialIndex(entity, newIndex);
         }
+        Detail::_spatialNodes[enumValue(entity.id)].position = loc;
     }
 
     static void zeroEntity(EntityBase* ent);
@@ -2,29 +2,15 @@
 #include "Entities/Entity.h"
 #include "OpenLoco.h"
 #include "Vehicles/Vehicle.h"
-#include <cmath>
-#include <iostream>
+#include <OpenLoco/Diagnostics/Profiler.h>
+#include <limits>
 
 namespace OpenLoco
 {
     using EntityListType = EntityManager::EntityListType;
     using EntityListIterator = EntityManager::ListIterator<EntityBase, &EntityBase::nextEntityId>;
 
-    template<EntityListType id, typename Pred>
-    void PopulateEntities(std::vector<EntityBase*>& list, std::vector<World::Pos3>& posList, const Pred& pred)
-    {
-        auto entsView = EntityManager::EntityList<EntityListIterator, id>();
-        for (auto* ent : entsView)
-        {
-            if (!pred(ent))
-            {
-                continue;
-            }
-
-            list.push_back(ent);
-            posList.emplace_back(ent->position);
-        }
-    }
+    static constexpr uint32_t kNoSlot = std::numeric_limits<uint32_t>::max();
 
     static EntityTweener _tweener;
 
@@ -33,71 +19,116 @@ namespace OpenLoco
         return _tweener;
     }
 
+    void EntityTweener::addEntity(EntityBase* entity)
+    {
+        const auto index = enumValue(entity->id);
+        if (index >= _slots.size())
+        {
+            _slots.resize(index + 1, kNoSlot);
+        }
+        _slots[index] = static_cast<uint32_t>(_entities.size());
+
+        _entities.push_back(entity);
+        _preX.push_back(entity->position.x);
+        _preY.push_back(entity->position.y);
+        _preZ.push_back(entity->position.z);
+    }
+
     void EntityTweener::preTick()
     {
+        OPENLOCO_PROFILE_ZONE("EntityTweener::preTick");
+
         restore();
         reset();
-        PopulateEntities<EntityListType::misc>(_entities, _prePos, [](auto*) { return true; });
-        PopulateEntities<EntityListType::vehicle>(_entities, _prePos, [](auto* ent) {
-            const auto* vehicle = ent->template asBase<Vehicles::VehicleBase>();
-            if (vehicle == nullptr)
+        for (auto* ent : EntityManager::EntityList<EntityListIterator, EntityListType::misc>())
+        {
+            addEntity(ent);
+        }
+        for (auto* ent : EntityManager::EntityList<EntityListIterator, EntityListType::vehicle>())
+        {
+            const auto* vehicle = ent->asBase<Vehicles::VehicleBase>();
+            if (vehicle != nullptr && (vehicle->isVehicleBody() || vehicle->isVehicleBogie()))
             {
-                // This can be never null but makes the compiler happy.
-                return false;
+                addEntity(ent);
             }
-            return vehicle->isVehicleBody() || vehicle->isVehicleBogie();
-        });
+        }
     }
 
     void EntityTweener::postTick()
     {
-        for (auto* ent : _entities)
+        OPENLOCO_PROFILE_ZONE("EntityTweener::postTick");
+
+        const auto count = _entities.size();
+        _postX.resize(count);
+        _postY.resize(count);
+        _postZ.resize(count);
+        _tweenX.resize(count);
+        _tweenY.resize(count);
+        _tweenZ.resize(count);
+
+        for (size_t i = 0; i < count; ++i)
         {
-            if (ent == nullptr || ent->id == EntityId::null)
-            {
-                // Sprite was removed, add a dummy position to keep the index aligned.
-                _postPos.emplace_back(0, 0, 0);
-            }
-            else
+            const auto* ent = _entities[i];
+            if (ent == nullptr)
             {
-                _postPos.emplace_back(ent->position);
+                // Entity was removed during the tick, hold it still so tween skips it.
+                _postX[i] = _preX[i];
+                _postY[i] = _preY[i];
+                _postZ[i] = _preZ[i];
+                continue;
             }
+            _postX[i] = ent->position.x;
+            _postY[i] = ent->position.y;
+            _postZ[i] = ent->position.z;
         }
     }
 
     void EntityTweener::removeEntity(const EntityBase* entity)
     {
-        auto it = std::find(_entities.begin(), _entities.end(), entity);
-        if (it != _entities.end())
+        const auto index = enumValue(entity->id);
+        if (index >= _slots.size() || _slots[index] == kNoSlot)
         {
-            *it = nullptr;
+            return;
+        }
+        _entities[_slots[index]] = nullptr;
+        _slots[index] = kNoSlot;
+    }
+
+    // Branch free so the compiler can vectorise it, rounds half away from zero like std::round.
+    static void interpolate(const int16_t* pre, const int16_t* post, int16_t* out, size_t count, float alpha)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto a = static_cast<float>(pre[i]);
+            const auto b = static_cast<float>(post[i]);
+            const auto value = a + (b - a) * alpha;
+            out[i] = static_cast<int16_t>(static_cast<int32_t>(value + (value < 0.0f ? -0.5f : 0.5f)));
         }
     }
 
     void EntityTweener::tween(float alpha)
     {
-        const float inv = (1.0f - alpha);
+        OPENLOCO_PROFILE_ZONE("EntityTweener::tween");
 
-        for (size_t i = 0; i < _entities.size(); ++i)
+        const auto count = _postX.size();
+        interpolate(_preX.data(), _postX.data(), _tweenX.data(), count, alpha);
+        interpolate(_preY.data(), _postY.data(), _tweenY.data(), count, alpha);
+        interpolate(_preZ.data(), _postZ.data(), _tweenZ.data(), count, alpha);
+
+        for (size_t i = 0; i < count; ++i)
         {
-            auto* ent = _entities[i];
-            if (ent == nullptr)
+            if (_preX[i] == _postX[i] && _preY[i] == _postY[i] && _preZ[i] == _postZ[i])
             {
                 continue;
             }
 
-            auto& posA = _prePos[i];
-            auto& posB = _postPos[i];
-
-            if (posA == posB)
+            auto* ent = _entities[i];
+            if (ent == nullptr)
             {
                 continue;
             }
 
-            auto newPos = World::Pos3{ static_cast<int16_t>(std::round(posB.x * alpha + posA.x * inv)),
-                                       static_cast<int16_t>(std::round(posB.y * alpha + posA.y * inv)),
-                                       static_cast<int16_t>(std::round(posB.z * alpha + posA.z * inv)) };
-
+            const auto newPos = World::Pos3{ _tweenX[i], _tweenY[i], _tweenZ[i] };
             if (ent->position == newPos)
             {
                 continue;
@@ -109,7 +140,7 @@ namespace OpenLoco
 
     void EntityTweener::restore()
     {
-        for (size_t i = 0; i < _entities.size(); ++i)
+        for (size_t i = 0; i < _postX.size(); ++i)
         {
             auto* ent = _entities[i];
             if (ent == nullptr)
@@ -117,8 +148,7 @@ namespace OpenLoco
                 continue;
             }
 
-            auto& newPos = _postPos[i];
-
+            const auto newPos = World::Pos3{ _postX[i], _postY[i], _postZ[i] };
             if (ent->position == newPos)
             {
                 continue;
@@ -130,9 +160,23 @@ namespace OpenLoco
 
     void EntityTweener::reset()
     {
+        for (const auto* ent : _entities)
+        {
+            if (ent != nullptr)
+            {
+                _slots[enumValue(ent->id)] = kNoSlot;
+            }
+        }
         _entities.clear();
-        _prePos.clear();
-        _postPos.clear();
+        _preX.clear();
+        _preY.clear();
+        _preZ.clear();
+        _postX.clear();
+        _postY.clear();
+        _postZ.clear();
+        _tweenX.clear();
+        _tweenY.clear();
+        _tweenZ.clear();
     }
 
 }
@@ -311,6 +311,7 @@ namespace OpenLoco::Environment
             case PathId::heightmap:
             case PathId::customObjects:
             case PathId::screenshots:
+            case PathId::traces:
                 return Platform::getUserDirectory();
             case PathId::languageFiles:
             case PathId::objects:
@@ -326,7 +327,7 @@ namespace OpenLoco::Environment
 
     static fs::path getSubPath(PathId id)
     {
-        static constexpr std::array<const char*, 60> kPaths = {
+        static constexpr std::array<const char*, 61> kPaths = {
             "Data/g1.DAT",
             "plugin.dat",
             "plugin2.dat",
@@ -387,6 +388,7 @@ namespace OpenLoco::Environment
             "objects",
             "objects",
             "screenshots",
+            "traces",
         };
 
         size_t index = (size_t)id;
@@ -5,6 +5,7 @@
 #include "Logging.h"
 #include "Map/RoadElement.h"
 #include "Map/TileManager.h"
+#include "Map/Track/Track.h"
 #include "Map/TrackElement.h"
 #include "MessageManager.h"
 #include "Scenario/Scenario.h"
@@ -51,6 +52,7 @@ namespace OpenLoco::GameCommands
                     trackElement.setOwner(ourCompanyId);
                 }
             }
+            World::Track::invalidateTrackNetwork();
 
             // Second phase: change ownership of all stations that currently belong to the target company.
             for (auto& station : StationManager::stations())
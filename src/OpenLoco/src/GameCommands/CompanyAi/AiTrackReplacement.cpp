@@ -7,6 +7,7 @@
 #include "Map/StationElement.h"
 #include "Map/SurfaceElement.h"
 #include "Map/TileManager.h"
+#include "Map/Track/Track.h"
 #include "Map/Track/TrackData.h"
 #include "Map/Track/TrackEnum.h"
 #include "Map/TrackElement.h"
@@ -314,6 +315,7 @@ namespace OpenLoco::GameCommands
                 if (flags & GameCommands::Flags::apply)
                 {
                     elTrack->setAiAllocated(false);
+                    World::Track::invalidateTrackNetwork();
                     World::TileManager::mapInvalidateTileFull(trackLoc);
                 }
             }
@@ -323,6 +325,7 @@ namespace OpenLoco::GameCommands
                 if (elSignal != nullptr && (flags & GameCommands::Flags::apply))
                 {
                     elSignal->setAiAllocated(false);
+                    World::Track::invalidateTrackNetwork();
                     World::TileManager::mapInvalidateTileFull(trackLoc);
                 }
             }
@@ -332,6 +335,7 @@ namespace OpenLoco::GameCommands
                 if (elStation != nullptr && (flags & GameCommands::Flags::apply))
                 {
                     elStation->setAiAllocated(false);
+                    World::Track::invalidateTrackNetwork();
                     World::TileManager::mapInvalidateTileFull(trackLoc);
                     const auto stationId = elStation->stationId();
                     getLegacyReturnState().lastPlacedTrackRoadStationId = stationId;
@@ -383,6 +387,7 @@ namespace OpenLoco::GameCommands
                 if (trackEl != nullptr)
                 {
                     trackEl->setHasLevelCrossing(true);
+                    World::Track::invalidateTrackNetwork();
                 }
             }
 
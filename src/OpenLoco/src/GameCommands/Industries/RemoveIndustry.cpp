@@ -23,6 +23,7 @@ namespace OpenLoco::GameCommands
     static void removeElement(const World::Pos2& pos, World::TileElementEntry& entry)
     {
         Ui::ViewportManager::invalidate(pos, entry.baseHeight(), entry.clearHeight());
+        invalidateCargoContribution(World::toTileSpace(pos));
         World::TileManager::removeElement(entry);
     }
 
@@ -299,6 +299,8 @@ namespace OpenLoco::GameCommands
         {
             if (!(flags & (Flags::aiAllocated | Flags::ghost)))
             {
+                // Existing signal elements are updated in place which the tile manager does not see
+                World::Track::invalidateTrackNetwork();
                 const uint16_t tad = args.rotation | (args.trackId << 3);
                 {
                     auto [nextLoc, nextRotation] = World::Track::getTrackConnectionEnd(trackStart, tad);
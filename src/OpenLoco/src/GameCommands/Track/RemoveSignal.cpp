@@ -2,6 +2,7 @@
 #include "Economy/Economy.h"
 #include "Map/SignalElement.h"
 #include "Map/TileManager.h"
+#include "Map/Track/Track.h"
 #include "Map/Track/TrackData.h"
 #include "Map/TrackElement.h"
 #include "Objects/ObjectManager.h"
@@ -180,6 +181,8 @@ namespace OpenLoco::GameCommands
         {
             if (!(flags & (Flags::aiAllocated | Flags::ghost)))
             {
+                // The signal element was modified in place above, drop cached blocks before recomputing them
+                World::Track::invalidateTrackNetwork();
                 const Vehicles::TrackAndDirection::_TrackAndDirection tad(args.trackId, args.rotation);
 
                 Vehicles::sub_4A2AD7(trackStart, tad, getUpdatingCompanyId(), args.trackObjType);
@@ -3,6 +3,7 @@
 #include "Graphics/DrawSpriteRLE.hpp"
 #include "Graphics/Gfx.h"
 #include "Graphics/RenderTarget.h"
+#include "Graphics/SpriteCache.h"
 
 namespace OpenLoco::Gfx
 {
@@ -178,6 +179,51 @@ namespace OpenLoco::Gfx
 #pragma GCC diagnostic pop
 #pragma warning(pop)
 
+    // Zoomed out RLE images are drawn at zoom level 0 from a cached copy holding only the sampled pixels.
+    template<uint8_t TZoomLevel>
+    static void drawRLESpriteDecimated(const RenderTarget& rt, const DrawSpriteArgs& args, const DrawBlendOp op)
+    {
+        constexpr int32_t zoom = 1 << TZoomLevel;
+        auto srcY = args.srcPos.y;
+        auto height = args.size.height;
+        auto dstY = args.dstPos.y;
+        // Same adjustment as drawRLESprite
+        if (srcY < 0)
+        {
+            srcY += zoom;
+            height -= zoom;
+            dstY++;
+        }
+        if (height <= 0 || args.size.width <= 0)
+        {
+            return;
+        }
+
+        const auto phase = Ui::Point(args.srcPos.x & (zoom - 1), srcY & (zoom - 1));
+        const auto decimated = SpriteCache::getDecimatedRLE(args.sourceImage, TZoomLevel, phase);
+        if (decimated == nullptr)
+        {
+            drawSpriteToBufferHelper<TZoomLevel, true>(rt, args, op);
+            return;
+        }
+
+        const auto decimatedSrcY = (srcY - phase.y) >> TZoomLevel;
+        const auto decimatedHeight = std::min<int32_t>((height + zoom - 1) >> TZoomLevel, decimated->height - decimatedSrcY);
+        if (decimatedHeight <= 0)
+        {
+            return;
+        }
+        const DrawSpriteArgs decimatedArgs{
+            args.palMap,
+            *decimated,
+            Ui::Point((args.srcPos.x - phase.x) >> TZoomLevel, decimatedSrcY),
+            Ui::Point(args.dstPos.x, dstY),
+            Ui::Size((args.size.width + zoom - 1) >> TZoomLevel, decimatedHeight),
+            nullptr
+        };
+        drawSpriteToBufferHelper<0, true>(rt, decimatedArgs, op);
+    }
+
     template<>
     void drawSpriteToBufferMagnify<false>(const RenderTarget& rt, ZoomLevel zoom, const DrawSpriteArgs& args, const DrawBlendOp op)
     {
@@ -186,6 +232,18 @@ namespace OpenLoco::Gfx
     template<>
     void drawSpriteToBufferMagnify<true>(const RenderTarget& rt, ZoomLevel zoom, const DrawSpriteArgs& args, const DrawBlendOp op)
     {
+        // Sampling the decoded bitmap avoids walking the runs for every pixel. Every op apart
+        // from none skips transparent pixels so drawing the gaps between runs has no effect.
+        if (op != DrawBlendOp::none)
+        {
+            const auto decoded = SpriteCache::getDecodedRLE(args.sourceImage);
+            if (decoded != nullptr)
+            {
+                const DrawSpriteArgs decodedArgs{ args.palMap, *decoded, args.srcPos, args.dstPos, args.size, nullptr };
+                drawSpriteToBufferMagnifyHelper<false>(rt, zoom, decodedArgs, op);
+                return;
+            }
+        }
         drawSpriteToBufferMagnifyHelper<true>(rt, zoom, args, op);
     }
 
@@ -217,16 +275,16 @@ namespace OpenLoco::Gfx
     template<>
     void drawSpriteToBuffer<1, true>(const RenderTarget& rt, const DrawSpriteArgs& args, const DrawBlendOp op)
     {
-        drawSpriteToBufferHelper<1, true>(rt, args, op);
+        drawRLESpriteDecimated<1>(rt, args, op);
     }
     template<>
     void drawSpriteToBuffer<2, true>(const RenderTarget& rt, const DrawSpriteArgs& args, const DrawBlendOp op)
     {
-        drawSpriteToBufferHelper<2, true>(rt, args, op);
+        drawRLESpriteDecimated<2>(rt, args, op);
     }
     template<>
     void drawSpriteToBuffer<3, true>(const RenderTarget& rt, const DrawSpriteArgs& args, const DrawBlendOp op)
     {
-        drawSpriteToBufferHelper<3, true>(rt, args, op);
+        drawRLESpriteDecimated<3>(rt, args, op);
     }
 }
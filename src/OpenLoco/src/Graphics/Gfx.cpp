@@ -9,6 +9,7 @@
 #include "Graphics/PaletteMap.h"
 #include "Graphics/RenderTarget.h"
 #include "Graphics/SoftwareDrawingEngine.h"
+#include "Graphics/SpriteCache.h"
 #include "Input.h"
 #include "Localisation/Formatting.h"
 #include "Localisation/LanguageFiles.h"
@@ -154,6 +155,7 @@ namespace OpenLoco::Gfx
             element.offset = reinterpret_cast<std::uint8_t*>(elementData.get()) + element.offset32;
         }
 
+        SpriteCache::invalidate();
         _g1Buffer = std::move(elementData);
         std::copy(elements.begin(), elements.end(), _g1Elements.begin());
     }
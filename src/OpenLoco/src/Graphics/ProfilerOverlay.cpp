@@ -0,0 +1,79 @@
+#include "Graphics/ProfilerOverlay.h"
+#include "Graphics/Colour.h"
+#include "Graphics/Gfx.h"
+#include "Graphics/SpriteCache.h"
+#include "Graphics/TextRenderer.h"
+#include "Localisation/Formatting.h"
+#include "Paint/Paint.h"
+#include <OpenLoco/Diagnostics/Profiler.h>
+
+#include <algorithm>
+#include <stdio.h>
+
+namespace OpenLoco::Gfx
+{
+    static constexpr int32_t kLineHeight = 10;
+    static constexpr size_t kMaxLines = 32;
+
+    static SpriteCache::Stats _lastSpriteCacheStats{};
+    static uint64_t _lastPaintArenaAllocations = 0;
+
+    // Draws the zones of the previous frame below the FPS counter.
+    void drawProfilerOverlay(DrawingContext& drawingCtx)
+    {
+        auto tr = Gfx::TextRenderer(drawingCtx);
+
+        const auto& stats = Diagnostics::Profiler::getLastFrameStats();
+
+        char buffer[128];
+        buffer[0] = ControlCodes::Font::small;
+        buffer[1] = ControlCodes::Font::outline;
+        buffer[2] = ControlCodes::Colour::white;
+
+        auto point = Ui::Point{ 4, 20 };
+        int32_t maxWidth = 0;
+
+        const auto drawLine = [&]() {
+            tr.drawString(point, Colour::black, buffer);
+            maxWidth = std::max<int32_t>(maxWidth, tr.getStringWidth(buffer));
+            point.y += kLineHeight;
+        };
+
+        snprintf(&buffer[3], std::size(buffer) - 3, "frame %.2f ms", stats.frameMs);
+        drawLine();
+
+        const auto numZones = std::min(stats.zones.size(), kMaxLines);
+        for (size_t i = 0; i < numZones; i++)
+        {
+            const auto& zone = stats.zones[i];
+            const auto indent = static_cast<int>(std::min<uint32_t>(zone.depth, 8) * 2);
+            if (zone.threads > 1)
+            {
+                snprintf(&buffer[3], std::size(buffer) - 3, "%*s%s %.2f ms (max %.2f) x%u on %u threads", indent, "", zone.name, zone.totalMs, zone.maxMs, zone.calls, zone.threads);
+            }
+            else
+            {
+                snprintf(&buffer[3], std::size(buffer) - 3, "%*s%s %.2f ms x%u", indent, "", zone.name, zone.totalMs, zone.calls);
+            }
+            drawLine();
+        }
+
+        // Sprite cache hits and misses since the overlay was last drawn
+        const auto spriteCacheStats = SpriteCache::getStats();
+        const auto hits = spriteCacheStats.hits - _lastSpriteCacheStats.hits;
+        const auto misses = spriteCacheStats.misses - _lastSpriteCacheStats.misses;
+        const auto hitRate = hits + misses != 0 ? 100.0 * hits / (hits + misses) : 0.0;
+        snprintf(&buffer[3], std::size(buffer) - 3, "sprite cache %.1f%% of %llu, %zu entries %zu/%zu KiB", hitRate, static_cast<unsigned long long>(hits + misses), spriteCacheStats.entries, spriteCacheStats.memoryUsage / 1024, spriteCacheStats.memoryBudget / 1024);
+        drawLine();
+        _lastSpriteCacheStats = spriteCacheStats;
+
+        // Paint arenas are reused between frames so this should be 0 once they have grown
+        const auto paintArenaStats = Paint::getPaintArenaStats();
+        snprintf(&buffer[3], std::size(buffer) - 3, "paint arenas %llu allocations, %zu KiB", static_cast<unsigned long long>(paintArenaStats.heapAllocations - _lastPaintArenaAllocations), paintArenaStats.reservedBytes / 1024);
+        drawLine();
+        _lastPaintArenaAllocations = paintArenaStats.heapAllocations;
+
+        // Make area dirty so the text doesn't get drawn over the last
+        invalidateRegion(4, 20, 4 + maxWidth, point.y);
+    }
+}
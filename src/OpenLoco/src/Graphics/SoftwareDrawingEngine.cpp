@@ -1,13 +1,16 @@
 #include "Graphics/SoftwareDrawingEngine.h"
 #include "Config.h"
 #include "Graphics/FPSCounter.h"
+#include "Graphics/ProfilerOverlay.h"
 #include "Graphics/RenderTarget.h"
 #include "Logging.h"
 #include "Ui.h"
 #include "Ui/WindowManager.h"
+#include <OpenLoco/Diagnostics/Profiler.h>
 
 #include <SDL3/SDL.h>
 #include <algorithm>
+#include <array>
 #include <cstdlib>
 
 using namespace OpenLoco::Gfx;
@@ -184,6 +187,11 @@ namespace OpenLoco::Gfx
         int16_t blockHeight = 1 << heightShift;
 
         _invalidationGrid.reset(scaledWidth, scaledHeight, blockWidth, blockHeight);
+        _presentGrid.reset(scaledWidth, scaledHeight, blockWidth, blockHeight);
+
+        // The output format may have changed and the texture holds no pixels yet.
+        updatePaletteLUT(0, 256);
+        _isFullPresentRequired = true;
 
         // Reset the drawing context, this holds the old screen render target.
         _ctx.reset();
@@ -206,6 +214,9 @@ namespace OpenLoco::Gfx
     void SoftwareDrawingEngine::invalidateRegion(int32_t left, int32_t top, int32_t right, int32_t bottom)
     {
         _invalidationGrid.invalidate(left, top, right, bottom);
+
+        // Also covers anything drawn after the dirty regions were rendered, such as the FPS counter.
+        _presentGrid.invalidate(left, top, right, bottom);
     }
 
     void SoftwareDrawingEngine::createPalette()
@@ -243,12 +254,40 @@ namespace OpenLoco::Gfx
         if (!SDL_SetPaletteColors(_palette, &base[index], index, count))
         {
             Logging::error("SDL_SetPaletteColors failed: {}", SDL_GetError());
+            return;
+        }
+
+        // Every pixel on screen may use the changed colours.
+        updatePaletteLUT(index, count);
+        _isFullPresentRequired = true;
+    }
+
+    void SoftwareDrawingEngine::updatePaletteLUT(int32_t index, int32_t count)
+    {
+        if (_palette == nullptr || _screenRGBASurface == nullptr)
+        {
+            return;
+        }
+
+        const auto* details = SDL_GetPixelFormatDetails(_screenRGBASurface->format);
+        if (details == nullptr)
+        {
+            Logging::error("SDL_GetPixelFormatDetails failed: {}", SDL_GetError());
+            return;
+        }
+
+        for (auto i = index; i < index + count; i++)
+        {
+            const auto& colour = _palette->colors[i];
+            _paletteLUT[i] = SDL_MapRGBA(details, nullptr, colour.r, colour.g, colour.b, colour.a);
         }
     }
 
     // 0x004C5CFA
     void SoftwareDrawingEngine::render()
     {
+        OPENLOCO_PROFILE_ZONE("SoftwareDrawingEngine::render");
+
         // Need to first render the current dirty regions before updating the viewports.
         // This is needed to ensure it will copy the correct pixels when the viewport will be moved.
         renderDirtyRegions();
@@ -264,6 +303,12 @@ namespace OpenLoco::Gfx
         {
             Gfx::drawFPS(_ctx);
         }
+
+        // Draw profiler overlay.
+        if (Config::get().showProfiler)
+        {
+            Gfx::drawProfilerOverlay(_ctx);
+        }
     }
 
     void SoftwareDrawingEngine::renderDirtyRegions()
@@ -286,6 +331,8 @@ namespace OpenLoco::Gfx
         rt.bits = _screenRT.bits + rect.left() + ((_screenRT.width + _screenRT.pitch) * rect.top());
         rt.pitch = _screenRT.width + _screenRT.pitch - rect.width();
 
+        _presentGrid.invalidate(rect.left(), rect.top(), rect.right(), rect.bottom());
+
         // Set the render target to the screen rt.
         _ctx.pushRenderTarget(rt);
 
@@ -300,40 +347,28 @@ namespace OpenLoco::Gfx
 
     void SoftwareDrawingEngine::present()
     {
-        // Lock the surface before setting its pixels
-        if (SDL_MUSTLOCK(_screenSurface))
+        OPENLOCO_PROFILE_ZONE("SoftwareDrawingEngine::present");
+
+        if (SDL_BYTESPERPIXEL(_screenRGBASurface->format) != sizeof(uint32_t))
         {
-            if (!SDL_LockSurface(_screenSurface))
+            // Leave unusual output formats to SDL.
+            if (!blitAndUploadScreen())
             {
                 return;
             }
         }
-
-        // Copy pixels from the virtual screen buffer to the surface
-        auto& rt = getScreenRT();
-        if (rt.bits != nullptr)
-        {
-            std::memcpy(_screenSurface->pixels, rt.bits, _screenSurface->pitch * _screenSurface->h);
-        }
-
-        // Unlock the surface
-        if (SDL_MUSTLOCK(_screenSurface))
-        {
-            SDL_UnlockSurface(_screenSurface);
-        }
-
-        // Convert colours via palette mapping onto the RGBA surface.
-        if (!SDL_BlitSurface(_screenSurface, nullptr, _screenRGBASurface, nullptr))
+        else
         {
-            Logging::error("SDL_BlitSurface {}", SDL_GetError());
-            return;
-        }
+            if (_isFullPresentRequired)
+            {
+                _presentGrid.invalidate(0, 0, _screenRGBASurface->w, _screenRGBASurface->h);
+                _isFullPresentRequired = false;
+            }
 
-        // Copy the RGBA pixels into screen texture.
-        if (!SDL_UpdateTexture(_screenTexture, nullptr, _screenRGBASurface->pixels, _screenRGBASurface->pitch))
-        {
-            Logging::error("SDL_UpdateTexture {}", SDL_GetError());
-            return;
+            // Only convert and upload what changed since the last present, idle frames upload nothing.
+            _presentGrid.traverseDirtyRows([this](int32_t left, int32_t top, int32_t right, int32_t bottom) {
+                this->convertAndUploadRegion(left, top, right, bottom);
+            });
         }
 
         const auto scaleFactor = Config::get().scaleFactor;
@@ -379,8 +414,102 @@ namespace OpenLoco::Gfx
         }
     }
 
+    bool SoftwareDrawingEngine::blitAndUploadScreen()
+    {
+        // Lock the surface before setting its pixels
+        if (SDL_MUSTLOCK(_screenSurface))
+        {
+            if (!SDL_LockSurface(_screenSurface))
+            {
+                return false;
+            }
+        }
+
+        // Copy pixels from the virtual screen buffer to the surface
+        auto& rt = getScreenRT();
+        if (rt.bits != nullptr)
+        {
+            std::memcpy(_screenSurface->pixels, rt.bits, _screenSurface->pitch * _screenSurface->h);
+        }
+
+        // Unlock the surface
+        if (SDL_MUSTLOCK(_screenSurface))
+        {
+            SDL_UnlockSurface(_screenSurface);
+        }
+
+        // Convert colours via palette mapping onto the RGBA surface.
+        if (!SDL_BlitSurface(_screenSurface, nullptr, _screenRGBASurface, nullptr))
+        {
+            Logging::error("SDL_BlitSurface {}", SDL_GetError());
+            return false;
+        }
+
+        // Copy the RGBA pixels into screen texture.
+        if (!SDL_UpdateTexture(_screenTexture, nullptr, _screenRGBASurface->pixels, _screenRGBASurface->pitch))
+        {
+            Logging::error("SDL_UpdateTexture {}", SDL_GetError());
+            return false;
+        }
+
+        return true;
+    }
+
+    // Converts palette indices to output pixels, kept free of branches so the compiler can vectorise it.
+    static void convertPaletteRow(const uint8_t* src, uint32_t* dst, size_t count, const std::array<uint32_t, 256>& lut)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            dst[i] = lut[src[i]];
+        }
+    }
+
+    void SoftwareDrawingEngine::convertAndUploadRegion(int32_t left, int32_t top, int32_t right, int32_t bottom)
+    {
+        auto& rt = getScreenRT();
+        if (rt.bits == nullptr)
+        {
+            return;
+        }
+
+        if (SDL_MUSTLOCK(_screenRGBASurface))
+        {
+            if (!SDL_LockSurface(_screenRGBASurface))
+            {
+                return;
+            }
+        }
+
+        const auto srcStride = rt.width + rt.pitch;
+        const auto dstPitch = _screenRGBASurface->pitch;
+        const auto* src = rt.bits + top * srcStride + left;
+        auto* dst = static_cast<uint8_t*>(_screenRGBASurface->pixels) + top * dstPitch + left * sizeof(uint32_t);
+        const auto width = static_cast<size_t>(right - left);
+        for (auto y = top; y < bottom; y++)
+        {
+            convertPaletteRow(src, reinterpret_cast<uint32_t*>(dst), width, _paletteLUT);
+            src += srcStride;
+            dst += dstPitch;
+        }
+
+        if (SDL_MUSTLOCK(_screenRGBASurface))
+        {
+            SDL_UnlockSurface(_screenRGBASurface);
+        }
+
+        // Copy the converted pixels into the screen texture.
+        const SDL_Rect region{ left, top, right - left, bottom - top };
+        const auto* pixels = static_cast<const uint8_t*>(_screenRGBASurface->pixels) + top * dstPitch + left * sizeof(uint32_t);
+        if (!SDL_UpdateTexture(_screenTexture, &region, pixels, dstPitch))
+        {
+            Logging::error("SDL_UpdateTexture {}", SDL_GetError());
+        }
+    }
+
     DrawingContext& SoftwareDrawingEngine::getDrawingContext()
     {
+        // Callers may draw onto the screen without invalidating what they touched, such as the intro.
+        _isFullPresentRequired = true;
         return _ctx;
     }
 
@@ -417,6 +546,8 @@ namespace OpenLoco::Gfx
         width += lmargin + rmargin;
         height += tmargin + bmargin;
 
+        _presentGrid.invalidate(dstX, dstY, dstX + width, dstY + height);
+
         int32_t stride = rt.width + rt.pitch;
         uint8_t* to = rt.bits + dstY * stride + dstX;
         uint8_t* from = rt.bits + (dstY - srcY) * stride + dstX - srcX;
@@ -0,0 +1,358 @@
+#include "Graphics/SpriteCache.h"
+#include "Graphics/Gfx.h"
+#include <OpenLoco/Diagnostics/Profiler.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace OpenLoco::Gfx::SpriteCache
+{
+    static constexpr size_t kMemoryBudget = 32 * 1024 * 1024;
+    // Rough cost of the bookkeeping of an entry on top of its image data
+    static constexpr size_t kEntryOverhead = 96;
+
+    // Zoom level 0 is used for the decoded bitmaps
+    struct Key
+    {
+        const uint8_t* data;
+        int16_t width;
+        int16_t height;
+        uint8_t zoomLevel;
+        uint8_t phaseX;
+        uint8_t phaseY;
+        bool hasTransparency;
+
+        bool operator==(const Key&) const = default;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const
+        {
+            auto hash = std::hash<const uint8_t*>{}(key.data);
+            hash ^= (static_cast<size_t>(static_cast<uint16_t>(key.width)) << 24)
+                ^ (static_cast<size_t>(static_cast<uint16_t>(key.height)) << 8)
+                ^ (static_cast<size_t>(key.zoomLevel) << 6)
+                ^ (static_cast<size_t>(key.phaseX) << 3)
+                ^ key.phaseY
+                ^ (static_cast<size_t>(key.hasTransparency) << 2);
+            return hash;
+        }
+    };
+
+    struct Image
+    {
+        std::vector<uint8_t> data;
+        G1Element element;
+    };
+
+    struct Entry
+    {
+        Key key;
+        // Images that could not be converted keep an entry without an image so they are not
+        // retried every draw.
+        std::unique_ptr<const Image> image;
+        size_t size;
+    };
+
+    // Each drawing thread has its own cache so a hit takes no lock. Counters are only written by
+    // their own thread and read by getStats.
+    struct ThreadCache
+    {
+        // Most recently used entries are at the front
+        std::list<Entry> entries;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> lookup;
+        uint32_t generation;
+        std::atomic<uint64_t> hits;
+        std::atomic<uint64_t> misses;
+        std::atomic<uint64_t> evictions;
+        std::atomic<size_t> numEntries;
+        std::atomic<size_t> memoryUsage;
+
+        ThreadCache();
+        ~ThreadCache();
+    };
+
+    // Bumped on invalidate, each thread clears its cache on its next lookup
+    static std::atomic<uint32_t> _generation;
+    // Guards the list of thread caches and the counters of threads that have exited
+    static std::mutex _threadCachesMutex;
+    static std::vector<ThreadCache*> _threadCaches;
+    static Stats _exitedThreadStats{};
+    static thread_local ThreadCache _threadCache;
+
+    ThreadCache::ThreadCache()
+        : generation(_generation.load(std::memory_order_acquire))
+    {
+        std::lock_guard lock(_threadCachesMutex);
+        _threadCaches.push_back(this);
+    }
+
+    ThreadCache::~ThreadCache()
+    {
+        std::lock_guard lock(_threadCachesMutex);
+        _exitedThreadStats.hits += hits;
+        _exitedThreadStats.misses += misses;
+        _exitedThreadStats.evictions += evictions;
+        _threadCaches.erase(std::find(_threadCaches.begin(), _threadCaches.end(), this));
+    }
+
+    // The budget is shared out between the threads that can draw at once
+    static size_t getThreadMemoryBudget()
+    {
+        static const size_t budget = kMemoryBudget / std::max(1u, std::thread::hardware_concurrency());
+        return budget;
+    }
+
+    // Only the owning thread writes the counters so they do not need a locked increment
+    static void increment(std::atomic<uint64_t>& counter)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    static uint16_t getLineOffset(const uint8_t* src, int32_t y)
+    {
+        return src[y * 2] | (src[y * 2 + 1] << 8);
+    }
+
+    // Calls fn(firstPixelX, numPixels, pixels) for every run of the line
+    template<typename TFunc>
+    static void forEachRun(const G1Element& element, int32_t y, TFunc&& fn)
+    {
+        const auto* nextRun = element.offset + getLineOffset(element.offset, y);
+        auto isEndOfLine = false;
+        while (!isEndOfLine)
+        {
+            const auto* src = nextRun;
+            auto dataSize = *src++;
+            const auto firstPixelX = *src++;
+            isEndOfLine = (dataSize & 0x80) != 0;
+            dataSize &= 0x7F;
+            nextRun = src + dataSize;
+
+            fn(static_cast<int32_t>(firstPixelX), static_cast<int32_t>(dataSize), src);
+        }
+    }
+
+    static bool decimateRLE(const G1Element& element, uint8_t zoomLevel, uint8_t phaseX, uint8_t phaseY, Image& image)
+    {
+        const int32_t zoom = 1 << zoomLevel;
+        // Zoomed out draws skip transparent pixels inside runs while the zoom level 0 draw
+        // of the decimated image copies runs as is, so they are left out of the runs.
+        const bool hasTransparency = element.hasFlags(G1ElementFlags::hasTransparency);
+        if (element.height <= phaseY || element.width <= phaseX)
+        {
+            return false;
+        }
+        const int32_t numLines = (element.height - phaseY + zoom - 1) >> zoomLevel;
+
+        auto& out = image.data;
+        out.resize(static_cast<size_t>(numLines) * 2);
+        for (int32_t line = 0; line < numLines; line++)
+        {
+            const auto lineOffset = out.size();
+            if (lineOffset > std::numeric_limits<uint16_t>::max())
+            {
+                return false;
+            }
+            out[line * 2] = lineOffset & 0xFF;
+            out[line * 2 + 1] = lineOffset >> 8;
+
+            constexpr auto kNoRun = std::numeric_limits<size_t>::max();
+            auto runStart = kNoRun;
+            int32_t lastX = -1;
+            auto isValid = true;
+            forEachRun(element, phaseY + (line << zoomLevel), [&](int32_t firstPixelX, int32_t numPixels, const uint8_t* pixels) {
+                // First pixel of the run that lines up with the sampled columns
+                const auto firstX = std::max<int32_t>(phaseX, firstPixelX + ((phaseX - firstPixelX) & (zoom - 1)));
+                for (auto x = firstX; x < firstPixelX + numPixels; x += zoom)
+                {
+                    const auto pixel = pixels[x - firstPixelX];
+                    if (hasTransparency && pixel == PaletteIndex::transparent)
+                    {
+                        continue;
+                    }
+                    const auto dstX = (x - phaseX) >> zoomLevel;
+                    if (runStart == kNoRun || dstX != lastX + 1 || out[runStart] == 0x7F)
+                    {
+                        if (dstX > std::numeric_limits<uint8_t>::max())
+                        {
+                            isValid = false;
+                            return;
+                        }
+                        runStart = out.size();
+                        out.push_back(0);
+                        out.push_back(static_cast<uint8_t>(dstX));
+                    }
+                    out.push_back(pixel);
+                    out[runStart]++;
+                    lastX = dstX;
+                }
+            });
+            if (!isValid)
+            {
+                return false;
+            }
+
+            if (runStart == kNoRun)
+            {
+                // Empty line
+                out.push_back(0x80);
+                out.push_back(0);
+            }
+            else
+            {
+                out[runStart] |= 0x80;
+            }
+        }
+
+        image.element.width = static_cast<int16_t>((element.width - phaseX + zoom - 1) >> zoomLevel);
+        image.element.height = static_cast<int16_t>(numLines);
+        image.element.flags = G1ElementFlags::isRLECompressed | (element.flags & G1ElementFlags::hasTransparency);
+        return true;
+    }
+
+    static bool decodeRLE(const G1Element& element, Image& image)
+    {
+        if (element.width <= 0 || element.height <= 0)
+        {
+            return false;
+        }
+        const auto width = static_cast<size_t>(element.width);
+
+        auto& out = image.data;
+        out.assign(width * element.height, PaletteIndex::transparent);
+        for (int32_t y = 0; y < element.height; y++)
+        {
+            auto* dstLine = out.data() + width * y;
+            forEachRun(element, y, [&](int32_t firstPixelX, int32_t numPixels, const uint8_t* pixels) {
+                const auto count = std::min<int32_t>(numPixels, element.width - firstPixelX);
+                if (count > 0)
+                {
+                    std::copy_n(pixels, count, dstLine + firstPixelX);
+                }
+            });
+        }
+
+        image.element.width = element.width;
+        image.element.height = element.height;
+        image.element.flags = G1ElementFlags::hasTransparency;
+        return true;
+    }
+
+    static void clear(ThreadCache& cache)
+    {
+        cache.lookup.clear();
+        cache.entries.clear();
+        cache.numEntries.store(0, std::memory_order_relaxed);
+        cache.memoryUsage.store(0, std::memory_order_relaxed);
+    }
+
+    static void evictLeastRecentlyUsed(ThreadCache& cache)
+    {
+        auto& entry = cache.entries.back();
+        cache.memoryUsage.store(cache.memoryUsage.load(std::memory_order_relaxed) - entry.size, std::memory_order_relaxed);
+        cache.lookup.erase(entry.key);
+        cache.entries.pop_back();
+        cache.numEntries.store(cache.entries.size(), std::memory_order_relaxed);
+        increment(cache.evictions);
+    }
+
+    template<typename TBuildFunc>
+    static const G1Element* getOrCreate(const Key& key, TBuildFunc&& build)
+    {
+        auto& cache = _threadCache;
+        const auto generation = _generation.load(std::memory_order_acquire);
+        if (cache.generation != generation)
+        {
+            clear(cache);
+            cache.generation = generation;
+        }
+
+        auto it = cache.lookup.find(key);
+        if (it != cache.lookup.end())
+        {
+            increment(cache.hits);
+            if (it->second != cache.entries.begin())
+            {
+                cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+            }
+            const auto& image = it->second->image;
+            return image != nullptr ? &image->element : nullptr;
+        }
+        increment(cache.misses);
+
+        OPENLOCO_PROFILE_ZONE("SpriteCache::build");
+
+        auto image = std::make_unique<Image>();
+        const auto isValid = build(*image);
+        if (!isValid)
+        {
+            image = nullptr;
+        }
+        else
+        {
+            image->data.shrink_to_fit();
+            image->element.offset = image->data.data();
+        }
+        const auto size = (image != nullptr ? image->data.capacity() : 0) + kEntryOverhead;
+        if (size > getThreadMemoryBudget())
+        {
+            return nullptr;
+        }
+
+        while (cache.memoryUsage.load(std::memory_order_relaxed) + size > getThreadMemoryBudget())
+        {
+            evictLeastRecentlyUsed(cache);
+        }
+
+        const auto* result = image != nullptr ? &image->element : nullptr;
+        cache.entries.push_front(Entry{ key, std::move(image), size });
+        cache.lookup.emplace(key, cache.entries.begin());
+        cache.numEntries.store(cache.entries.size(), std::memory_order_relaxed);
+        cache.memoryUsage.store(cache.memoryUsage.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+        return result;
+    }
+
+    const G1Element* getDecimatedRLE(const G1Element& element, uint8_t zoomLevel, Ui::Point phase)
+    {
+        const auto phaseX = static_cast<uint8_t>(phase.x);
+        const auto phaseY = static_cast<uint8_t>(phase.y);
+        const Key key{ element.offset, element.width, element.height, zoomLevel, phaseX, phaseY, element.hasFlags(G1ElementFlags::hasTransparency) };
+        return getOrCreate(key, [&](Image& image) { return decimateRLE(element, zoomLevel, phaseX, phaseY, image); });
+    }
+
+    const G1Element* getDecodedRLE(const G1Element& element)
+    {
+        const Key key{ element.offset, element.width, element.height, 0, 0, 0, false };
+        return getOrCreate(key, [&](Image& image) { return decodeRLE(element, image); });
+    }
+
+    void invalidate()
+    {
+        _generation.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    Stats getStats()
+    {
+        std::lock_guard lock(_threadCachesMutex);
+        auto stats = _exitedThreadStats;
+        stats.memoryBudget = kMemoryBudget;
+        for (const auto* cache : _threadCaches)
+        {
+            stats.hits += cache->hits.load(std::memory_order_relaxed);
+            stats.misses += cache->misses.load(std::memory_order_relaxed);
+            stats.evictions += cache->evictions.load(std::memory_order_relaxed);
+            stats.entries += cache->numEntries.load(std::memory_order_relaxed);
+            stats.memoryUsage += cache->memoryUsage.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+}
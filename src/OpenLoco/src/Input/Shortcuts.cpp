@@ -1,9 +1,11 @@
 #include "Input/Shortcuts.h"
 #include "Config.h"
+#include "Environment.h"
 #include "GameCommands/GameCommands.h"
 #include "GameCommands/General/SetGameSpeed.h"
 #include "GameCommands/General/TogglePause.h"
 #include "GameState.h"
+#include "Graphics/Gfx.h"
 #include "Input.h"
 #include "Localisation/FormatArguments.hpp"
 #include "Localisation/StringIds.h"
@@ -17,8 +19,11 @@
 #include "World/CompanyManager.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
+#include <OpenLoco/Diagnostics/Profiler.h>
 #include <OpenLoco/Engine/Input/ShortcutManager.h>
 #include <SDL3/SDL_keyboard.h>
+#include <cstdio>
+#include <ctime>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -687,6 +692,54 @@ namespace OpenLoco::Input::Shortcuts
         Windows::Debug::open();
     }
 
+    static void toggleProfilerOverlay()
+    {
+        auto& cfg = Config::get();
+        cfg.showProfiler ^= true;
+        Config::write();
+
+        Gfx::invalidateScreen();
+    }
+
+    static void exportProfilerTrace()
+    {
+        if (!Diagnostics::Profiler::isCapturing())
+        {
+            Diagnostics::Profiler::beginCapture();
+            Windows::Error::openQuiet(StringIds::profiler_trace_capture_started, StringIds::null);
+            return;
+        }
+
+        Diagnostics::Profiler::endCapture();
+
+        auto time = std::time(nullptr);
+        auto localTime = std::localtime(&time);
+        char fileName[64];
+        snprintf(
+            fileName,
+            sizeof(fileName),
+            "trace_%04u-%02u-%02u_%02u-%02u-%02u.json",
+            localTime->tm_year + 1900,
+            localTime->tm_mon + 1,
+            localTime->tm_mday,
+            localTime->tm_hour,
+            localTime->tm_min,
+            localTime->tm_sec);
+
+        auto traceFolderPath = Environment::getPathNoWarning(Environment::PathId::traces);
+        Environment::autoCreateDirectory(traceFolderPath);
+
+        if (Diagnostics::Profiler::exportChromeTrace(traceFolderPath / fileName))
+        {
+            FormatArguments::common(static_cast<const char*>(fileName));
+            Windows::Error::openQuiet(StringIds::profiler_trace_saved_as, StringIds::null);
+        }
+        else
+        {
+            Windows::Error::open(StringIds::profiler_trace_failed);
+        }
+    }
+
     void initialize()
     {
         // clang-format off
@@ -744,6 +797,8 @@ namespace OpenLoco::Input::Shortcuts
         ShortcutManager::add(Shortcut::gameSpeedFastForward,            StringIds::shortcut_game_speed_fast_forward,            gameSpeedFastForward,           "gameSpeedFastForward",             "");
         ShortcutManager::add(Shortcut::gameSpeedExtraFastForward,       StringIds::shortcut_game_speed_extra_fast_forward,      gameSpeedExtraFastForward,      "gameSpeedExtraFastForward",        "");
         ShortcutManager::add(Shortcut::openDebugWindow,                 StringIds::shortcut_debug_window,                       openDebugWindow,                "openDebugWindow",                  "F10");
+        ShortcutManager::add(Shortcut::toggleProfilerOverlay,           StringIds::shortcut_toggle_profiler_overlay,            toggleProfilerOverlay,          "toggleProfilerOverlay",            "");
+        ShortcutManager::add(Shortcut::exportProfilerTrace,             StringIds::shortcut_export_profiler_trace,              exportProfilerTrace,            "exportProfilerTrace",              "");
         // clang-format on
 
         loadBindings();
@@ -124,6 +124,10 @@ namespace OpenLoco::World
                 elBuilding2.setConstructed(isConstructed);
                 elBuilding2.setUnk5u(newUnk5u);
                 elBuilding2.setAge(newAge);
+                if (isConstructed)
+                {
+                    invalidateCargoContribution(World::toTileSpace(pos));
+                }
                 Ui::ViewportManager::invalidate(pos, elBuilding2.baseHeight(), elBuilding2.clearHeight(), ZoomLevel::quarter);
             });
         }
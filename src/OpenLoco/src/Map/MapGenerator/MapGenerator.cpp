@@ -660,7 +660,8 @@ namespace OpenLoco::World::MapGenerator
             const auto randDensity = (gPrng1().randNext(15) * std::max(options.maxForestDensity - options.minForestDensity, 0)) / 15 + options.minForestDensity;
             placeTreeCluster(randLoc, randRadius, randDensity, std::nullopt);
 
-            if (TileManager::numFreeElements() < 0x1B000)
+            // Counted as the original allocator did so the same forests are placed for a seed
+            if (TileManager::numFreeElementsAppendOnly() < 0x1B000)
             {
                 break;
             }
@@ -18,6 +18,7 @@
 #include "Map/SurfaceElement.h"
 #include "Map/TileClearance.h"
 #include "Map/TileElementEntry.h"
+#include "Map/Track/Track.h"
 #include "Map/TrackElement.h"
 #include "Map/TreeElement.h"
 #include "Map/WallElement.h"
@@ -37,13 +38,19 @@
 #include "ViewportManager.h"
 #include "World/CompanyManager.h"
 #include "World/IndustryManager.h"
+#include "World/Station.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Core/Store.hpp>
 #include <OpenLoco/Diagnostics/Assertion.h>
 #include <OpenLoco/Diagnostics/Logging.h>
+#include <OpenLoco/Diagnostics/Profiler.h>
 #include <OpenLoco/Engine/World.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cstdlib>
-#include <set>
+#include <optional>
+#include <span>
 
 using namespace OpenLoco::Diagnostics;
 
@@ -60,6 +67,187 @@ namespace OpenLoco::World::TileManager
     static uint32_t _periodicDefragStartTile;
     static bool _disablePeriodicDefrag;
 
+    // Where entriesEnd would be had every insert moved its tile to the end, as the original
+    // allocator did. Reset whenever the entries are packed, see numFreeElementsAppendOnly.
+    static size_t _appendOnlyEntriesEnd;
+
+    // Runs of empty entries below entriesEnd. The length of each run is stored at its first and
+    // last entry so a released range can be merged with its neighbours without a lookup, the
+    // first entry also holds the run's position in its length bucket.
+    struct FreeRunTag
+    {
+        uint32_t length;
+        uint32_t slot;
+    };
+    static std::vector<FreeRunTag> _freeRunTags;
+
+    // Starts of free runs by length so a growing tile can be moved into the smallest run that fits
+    // it, the last bucket holds every longer run. Single entries are left out as a tile that moves
+    // needs room for at least two.
+    static constexpr uint32_t kFreeRunBuckets = 64;
+    static std::array<std::vector<uint32_t>, kFreeRunBuckets> _freeRunsByLength;
+    static uint64_t _freeRunBucketsUsed;
+
+    static uint32_t getFreeRunBucket(uint32_t length)
+    {
+        return std::min(length, kFreeRunBuckets) - 1;
+    }
+
+    static void addFreeRun(uint32_t start, uint32_t length)
+    {
+        _freeRunTags[start + length - 1].length = length;
+        _freeRunTags[start].length = length;
+        if (length < 2)
+        {
+            return;
+        }
+
+        const auto bucket = getFreeRunBucket(length);
+        auto& starts = _freeRunsByLength[bucket];
+        _freeRunTags[start].slot = static_cast<uint32_t>(starts.size());
+        starts.push_back(start);
+        _freeRunBucketsUsed |= 1ULL << bucket;
+    }
+
+    static void removeFreeRun(uint32_t start)
+    {
+        const auto& tag = _freeRunTags[start];
+        if (tag.length < 2)
+        {
+            return;
+        }
+
+        const auto bucket = getFreeRunBucket(tag.length);
+        auto& starts = _freeRunsByLength[bucket];
+        const auto moved = starts.back();
+        starts[tag.slot] = moved;
+        _freeRunTags[moved].slot = tag.slot;
+        starts.pop_back();
+        if (starts.empty())
+        {
+            _freeRunBucketsUsed &= ~(1ULL << bucket);
+        }
+    }
+
+    // Marks [start, start + length) as free, the entries must already be empty. The range is
+    // merged with the neighbouring runs and given back to the free space at the end if it reaches
+    // entriesEnd.
+    static void releaseEntryRange(uint32_t start, uint32_t length)
+    {
+        const auto& entries = tileState().entries;
+        auto end = start + length;
+        if (end < tileState().entriesEnd && entries[end].isEmpty())
+        {
+            removeFreeRun(end);
+            end += _freeRunTags[end].length;
+        }
+        if (start > 0 && entries[start - 1].isEmpty())
+        {
+            start -= _freeRunTags[start - 1].length;
+            removeFreeRun(start);
+        }
+
+        if (end >= tileState().entriesEnd)
+        {
+            tileState().entriesEnd = start;
+            return;
+        }
+        addFreeRun(start, end - start);
+    }
+
+    // Marks [start, start + length) as used, it must either be at the start of a free run or at entriesEnd.
+    static void reserveEntryRange(uint32_t start, uint32_t length)
+    {
+        const auto end = start + length;
+        if (start >= tileState().entriesEnd)
+        {
+            Diagnostics::Assert::eq(static_cast<std::ptrdiff_t>(start), tileState().entriesEnd);
+            tileState().entriesEnd = end;
+            return;
+        }
+
+        Diagnostics::Assert::isTrue(tileState().entries[start].isEmpty() && (start == 0 || !tileState().entries[start - 1].isEmpty()));
+        const auto runLength = _freeRunTags[start].length;
+        Diagnostics::Assert::le(length, runLength);
+        removeFreeRun(start);
+        if (length < runLength)
+        {
+            addFreeRun(end, runLength - length);
+        }
+    }
+
+    // Returns the start of the smallest free run that can hold the given number of entries.
+    static std::optional<uint32_t> findFreeRun(uint32_t length)
+    {
+        const auto bucket = getFreeRunBucket(length);
+        if (bucket < kFreeRunBuckets - 1)
+        {
+            const auto used = _freeRunBucketsUsed >> bucket;
+            if (used == 0)
+            {
+                return std::nullopt;
+            }
+            const auto found = bucket + std::countr_zero(used);
+            if (found < kFreeRunBuckets - 1)
+            {
+                return _freeRunsByLength[found].back();
+            }
+        }
+
+        // Longer runs are not ordered by length, take the first that fits
+        for (const auto start : _freeRunsByLength[kFreeRunBuckets - 1])
+        {
+            if (_freeRunTags[start].length >= length)
+            {
+                return start;
+            }
+        }
+        return std::nullopt;
+    }
+
+    static uint32_t countTileEntries(const TileElementEntry* first)
+    {
+        uint32_t count = 1;
+        while (!first->isLast())
+        {
+            first++;
+            count++;
+        }
+        return count;
+    }
+
+    static void rebuildFreeRuns()
+    {
+        _freeRunTags.resize(kMaxElements);
+        for (auto& starts : _freeRunsByLength)
+        {
+            starts.clear();
+        }
+        _freeRunBucketsUsed = 0;
+
+        const auto& entries = tileState().entries;
+        const auto entriesEnd = static_cast<uint32_t>(tileState().entriesEnd);
+        for (uint32_t i = 0; i < entriesEnd;)
+        {
+            if (!entries[i].isEmpty())
+            {
+                i++;
+                continue;
+            }
+            const auto start = i;
+            while (i < entriesEnd && entries[i].isEmpty())
+            {
+                i++;
+            }
+            addFreeRun(start, i - start);
+        }
+    }
+
+    static uint32_t getEntryIndex(const TileElementEntry* entry)
+    {
+        return static_cast<uint32_t>(entry - tileState().entries.data());
+    }
+
     template<>
     Store<SurfaceElement>& getStore<SurfaceElement>()
     {
@@ -242,6 +430,7 @@ namespace OpenLoco::World::TileManager
         tileState().entriesEnd = kInitialEntries;
 
         updateTilePointers();
+        resetCargoContributions();
         getGameState().flags |= GameStateFlags::tileManagerLoaded;
     }
 
@@ -255,20 +444,51 @@ namespace OpenLoco::World::TileManager
         return static_cast<uint32_t>(kMaxElements - tileState().entriesEnd);
     }
 
+    uint32_t numFreeElementsAppendOnly()
+    {
+        return static_cast<uint32_t>(kMaxElements - std::min(_appendOnlyEntriesEnd, kMaxElements));
+    }
+
+    FragmentationStats getFragmentationStats()
+    {
+        FragmentationStats stats{};
+        stats.entriesEnd = static_cast<uint32_t>(tileState().entriesEnd);
+
+        const auto& entries = tileState().entries;
+        for (uint32_t i = 0; i < stats.entriesEnd; i++)
+        {
+            if (entries[i].isEmpty())
+            {
+                const auto length = _freeRunTags[i].length;
+                stats.freeRuns++;
+                stats.freeEntries += length;
+                stats.largestFreeRun = std::max(stats.largestFreeRun, length);
+                i += length - 1;
+            }
+        }
+        return stats;
+    }
+
     // Note: Must be past the last tile flag
     static void markEntryAsFree(TileElementEntry* entry)
     {
         *entry = TileElementEntry::empty();
-        const auto pastIdx = (entry + 1) - &tileState().entries[0];
-        if (pastIdx == tileState().entriesEnd)
+        releaseEntryRange(getEntryIndex(entry), 1);
+    }
+
+    static void invalidateTrackNetwork(ElementType type)
+    {
+        if (type == ElementType::track || type == ElementType::signal || type == ElementType::station || type == ElementType::road)
         {
-            tileState().entriesEnd--;
+            Track::invalidateTrackNetwork();
         }
     }
 
     // 0x00461760
     void removeElement(TileElementEntry& entry)
     {
+        invalidateTrackNetwork(entry.type());
+
         // This is used to indicate if the caller can still use this pointer
         if (&entry == _F00158)
         {
@@ -376,109 +596,131 @@ namespace OpenLoco::World::TileManager
         tileState().tiles[index] = entries;
     }
 
-    static std::pair<TileElementEntry*, TileElementEntry*> insertElementPrepareDest(const TilePos2 pos)
+    static TileElementEntry* insertElementGetTile(const TilePos2 pos)
     {
         const auto index = getTileIndex(pos);
         if (index >= tileState().tiles.size())
         {
             Logging::error("Attempted to get tile out of bounds! ({0}, {1})", pos.x, pos.y);
-            return std::make_pair(nullptr, nullptr);
+            return nullptr;
         }
-
-        auto* source = tileState().tiles[index];
-        // entriesEnd points to the free space at the end of the
-        // tile elements. You must always check there is space (checkFreeElementsAndReorganise)
-        // prior to calling this function!
-        auto* dest = &tileState().entries[tileState().entriesEnd];
-        set(pos, dest);
-        return std::make_pair(source, dest);
+        return tileState().tiles[index];
     }
 
-    static TileElementEntry* insertElementEnd(ElementType type, uint8_t baseZ, uint8_t occupiedQuads, TileElementEntry* source, TileElementEntry* dest, bool lastFound)
+    static TileElementEntry allocElementOfType(ElementType type)
     {
-        auto* newEntry = dest++;
-
         switch (type)
         {
             case ElementType::surface:
-                *newEntry = allocElement(SurfaceElement{});
-                break;
+                return allocElement(SurfaceElement{});
             case ElementType::track:
-                *newEntry = allocElement(TrackElement{});
-                break;
+                return allocElement(TrackElement{});
             case ElementType::station:
-                *newEntry = allocElement(StationElement{});
-                break;
+                return allocElement(StationElement{});
             case ElementType::signal:
-                *newEntry = allocElement(SignalElement{});
-                break;
+                return allocElement(SignalElement{});
             case ElementType::building:
-                *newEntry = allocElement(BuildingElement{});
-                break;
+                return allocElement(BuildingElement{});
             case ElementType::tree:
-                *newEntry = allocElement(TreeElement{});
-                break;
+                return allocElement(TreeElement{});
             case ElementType::wall:
-                *newEntry = allocElement(WallElement{});
-                break;
+                return allocElement(WallElement{});
             case ElementType::road:
-                *newEntry = allocElement(RoadElement{});
-                break;
+                return allocElement(RoadElement{});
             case ElementType::industry:
-                *newEntry = allocElement(IndustryElement{});
-                break;
+                return allocElement(IndustryElement{});
+        }
+        return TileElementEntry::empty();
+    }
+
+    // Inserts a new element after the first numBelow entries of the tile. The tile grows in place
+    // when the entry after it is free, otherwise it is moved into the smallest free run that fits
+    // or to entriesEnd which points to the free space at the end of the tile elements.
+    // You must always check there is space (checkFreeElementsAndReorganise) prior to calling this function!
+    static TileElementEntry* insertElementAt(const TilePos2 pos, TileElementEntry* source, uint32_t numBelow, ElementType type, uint8_t baseZ, uint8_t occupiedQuads)
+    {
+        const auto sourceIndex = getEntryIndex(source);
+        const auto numEntries = countTileEntries(source);
+        const auto sourceEnd = sourceIndex + numEntries;
+        const bool lastFound = numBelow == numEntries;
+        _appendOnlyEntriesEnd += numEntries + 1;
+
+        TileElementEntry* dest = nullptr;
+        if (sourceEnd == tileState().entriesEnd || tileState().entries[sourceEnd].isEmpty())
+        {
+            reserveEntryRange(sourceEnd, 1);
+            dest = source;
+            std::move_backward(source + numBelow, source + numEntries, source + numEntries + 1);
+        }
+        else
+        {
+            const auto destIndex = findFreeRun(numEntries + 1).value_or(static_cast<uint32_t>(tileState().entriesEnd));
+            reserveEntryRange(destIndex, numEntries + 1);
+            dest = &tileState().entries[destIndex];
+
+            std::copy(source, source + numBelow, dest);
+            std::copy(source + numBelow, source + numEntries, dest + numBelow + 1);
+            set(pos, dest);
         }
+
+        if (lastFound)
+        {
+            // The new element will become the last
+            // so we are clearing the flag
+            dest[numBelow - 1].setLastFlag(false);
+        }
+
+        invalidateTrackNetwork(type);
+
+        auto* newEntry = &dest[numBelow];
+        *newEntry = allocElementOfType(type);
         newEntry->setBaseZ(baseZ);
         newEntry->setClearZ(baseZ);
         newEntry->setOccupiedQuarter(occupiedQuads);
         newEntry->setLastFlag(lastFound);
 
-        if (!lastFound)
+        // Only free the old location once the new one is filled, otherwise the unset entry
+        // would be merged into the free run
+        if (dest != source)
         {
-            // Copy all of the elements that are above the new tile
-            do
-            {
-                *dest = *source;
-                *source = TileElementEntry::empty();
-                source++;
-            } while (!dest++->isLast());
+            std::fill(source, source + numEntries, TileElementEntry::empty());
+            releaseEntryRange(sourceIndex, numEntries);
         }
-        tileState().entriesEnd = std::distance(&tileState().entries[0], dest);
-
         return newEntry;
     }
 
+    static void invalidateCargoContributionOnInsert(ElementType type, const Pos2& pos)
+    {
+        if (type == ElementType::building || type == ElementType::industry)
+        {
+            OpenLoco::invalidateCargoContribution(toTileSpace(pos));
+        }
+    }
+
     // 0x004616D6
     TileElementEntry* insertElement(ElementType type, const Pos2& pos, uint8_t baseZ, uint8_t occupiedQuads)
     {
         checkFreeElementsAndReorganise();
+        invalidateCargoContributionOnInsert(type, pos);
 
-        auto [source, dest] = insertElementPrepareDest(toTileSpace(pos));
+        auto* source = insertElementGetTile(toTileSpace(pos));
         if (source == nullptr)
         {
             return nullptr;
         }
 
-        bool lastFound = false;
-        // Copy all of the elements that are underneath the new tile (or till end)
-        while (baseZ >= resolveEntry(source).baseZ())
+        // Count all of the elements that are underneath the new tile (or till end)
+        uint32_t numBelow = 0;
+        for (auto* entry = source; baseZ >= resolveEntry(entry).baseZ(); entry++)
         {
-            *dest = *source;
-            *source = TileElementEntry::empty();
-            source++;
-            if (dest->isLast())
+            numBelow++;
+            if (entry->isLast())
             {
-                // The new element will become the last
-                // so we are clearing the flag
-                dest->setLastFlag(false);
-                dest++;
-                lastFound = true;
                 break;
             }
-            dest++;
         }
 
-        return insertElementEnd(type, baseZ, occupiedQuads, source, dest, lastFound);
+        return insertElementAt(toTileSpace(pos), source, numBelow, type, baseZ, occupiedQuads);
     }
 
     // 0x0046166C
@@ -486,13 +728,12 @@ namespace OpenLoco::World::TileManager
     {
         checkFreeElementsAndReorganise();
 
-        auto [source, dest] = insertElementPrepareDest(toTileSpace(pos));
+        auto* source = insertElementGetTile(toTileSpace(pos));
         if (source == nullptr)
         {
             return nullptr;
         }
 
-        bool lastFound = false;
         auto isRoadStation = [](const TileElementEntry* sourceEntry, SmallZ baseZ) {
             if (baseZ != sourceEntry->baseZ())
             {
@@ -506,56 +747,42 @@ namespace OpenLoco::World::TileManager
             return srcStation->stationType() == StationType::roadStation;
         };
 
-        // Copy all of the elements that are underneath the new tile (or till end)
-        while (baseZ >= source->baseZ() && !isRoadStation(source, baseZ))
+        // Count all of the elements that are underneath the new tile (or till end)
+        uint32_t numBelow = 0;
+        for (auto* entry = source; baseZ >= entry->baseZ() && !isRoadStation(entry, baseZ); entry++)
         {
-            *dest = *source;
-            *source = TileElementEntry::empty();
-            source++;
-            if (dest->isLast())
+            numBelow++;
+            if (entry->isLast())
             {
-                // The new element will become the last
-                // so we are clearing the flag
-                dest->setLastFlag(false);
-                dest++;
-                lastFound = true;
                 break;
             }
-            dest++;
         }
 
-        return insertElementEnd(ElementType::road, baseZ, occupiedQuads, source, dest, lastFound);
+        return insertElementAt(toTileSpace(pos), source, numBelow, ElementType::road, baseZ, occupiedQuads);
     }
 
     // 0x00461578
     TileElementEntry* insertElementAfterNoReorg(TileElementEntry* after, ElementType type, const Pos2& pos, uint8_t baseZ, uint8_t occupiedQuads)
     {
-        auto [source, dest] = insertElementPrepareDest(toTileSpace(pos));
+        invalidateCargoContributionOnInsert(type, pos);
+        auto* source = insertElementGetTile(toTileSpace(pos));
         if (source == nullptr)
         {
             return nullptr;
         }
 
-        bool lastFound = false;
-        // Copy all of the elements that are underneath the new tile (or till end)
-        while (source <= after)
+        // Count all of the elements that are underneath the new tile (or till end)
+        uint32_t numBelow = 0;
+        for (auto* entry = source; entry <= after; entry++)
         {
-            *dest = *source;
-            *source = TileElementEntry::empty();
-            source++;
-            if (dest->isLast())
+            numBelow++;
+            if (entry->isLast())
             {
-                // The new element will become the last
-                // so we are clearing the flag
-                dest->setLastFlag(false);
-                dest++;
-                lastFound = true;
                 break;
             }
-            dest++;
         }
 
-        return insertElementEnd(type, baseZ, occupiedQuads, source, dest, lastFound);
+        return insertElementAt(toTileSpace(pos), source, numBelow, type, baseZ, occupiedQuads);
     }
 
     constexpr uint8_t kTileSize = 31;
@@ -823,6 +1050,47 @@ namespace OpenLoco::World::TileManager
         }
 
         tileState().entriesEnd = static_cast<ptrdiff_t>(i);
+        _appendOnlyEntriesEnd = i;
+        rebuildFreeRuns();
+        Track::invalidateTrackNetwork();
+    }
+
+    // Rebuilds the store so that elements of the given type are laid out in the same order as
+    // the entries referencing them, walking neighbouring tiles then reads memory sequentially.
+    template<typename T>
+    static void repackStore(Store<T>& store, std::span<TileElementEntry> entries)
+    {
+        Store<T> packed;
+        packed.reserve(store.size());
+        for (auto& entry : entries)
+        {
+            if (entry.type() != T::kElementType)
+            {
+                continue;
+            }
+            const auto newIndex = packed.allocate();
+            packed[newIndex] = store[entry.index()];
+            entry.setIndex(newIndex);
+        }
+        store = std::move(packed);
+    }
+
+    void repackElementStores()
+    {
+        // Afterwards every entry below entriesEnd is live
+        reorganise();
+
+        auto& entries = tileState().entries;
+        const auto live = std::span<TileElementEntry>(entries.data(), static_cast<size_t>(tileState().entriesEnd));
+        repackStore(tileState().surface, live);
+        repackStore(tileState().track, live);
+        repackStore(tileState().station, live);
+        repackStore(tileState().signal, live);
+        repackStore(tileState().building, live);
+        repackStore(tileState().tree, live);
+        repackStore(tileState().wall, live);
+        repackStore(tileState().road, live);
+        repackStore(tileState().industry, live);
     }
 
     // 0x0046148F
@@ -833,11 +1101,13 @@ namespace OpenLoco::World::TileManager
 
         try
         {
-            // Allocate a temporary buffer and tightly pack all the tile elements in the map
+            // Allocate a temporary buffer only as large as the live entries, everything
+            // else below entriesEnd is a free run
+            const auto stats = getFragmentationStats();
             std::vector<TileElementEntry> temp;
-            temp.resize(kMaxElements, TileElementEntry::empty());
+            temp.reserve(stats.entriesEnd - stats.freeEntries);
 
-            size_t numEntries = 0;
+            // Tightly pack all the tile elements in the map
             for (tile_coord_t y = 0; y < kMapRows; y++)
             {
                 for (tile_coord_t x = 0; x < kMapColumns; x++)
@@ -845,16 +1115,20 @@ namespace OpenLoco::World::TileManager
                     auto tile = get(TilePos2(x, y));
                     for (auto& el : tile)
                     {
-                        temp[numEntries] = el;
-                        numEntries++;
+                        temp.push_back(el);
                     }
                 }
             }
 
             // Copy organised elements back to original element buffer
             Diagnostics::Assert::eq(tileState().entries.size(), kMaxElements);
-            std::ranges::copy(temp, tileState().entries.begin());
-            tileState().entriesEnd = static_cast<ptrdiff_t>(numEntries);
+            const auto oldEnd = tileState().entries.begin() + tileState().entriesEnd;
+            const auto newEnd = std::ranges::copy(temp, tileState().entries.begin()).out;
+            if (newEnd < oldEnd)
+            {
+                std::fill(newEnd, oldEnd, TileElementEntry::empty());
+            }
+            tileState().entriesEnd = static_cast<ptrdiff_t>(temp.size());
 
             updateTilePointers();
         }
@@ -893,18 +1167,20 @@ namespace OpenLoco::World::TileManager
         }
 
         auto* firstTile = tileState().tiles[_periodicDefragStartTile];
-        auto* emptyTile = firstTile - 1;
-        while (emptyTile != &tileState().entries[0] && emptyTile->isEmpty())
-        {
-            emptyTile--;
-        }
-        emptyTile++;
-        if (emptyTile == firstTile)
+        const auto firstIndex = getEntryIndex(firstTile);
+        if (firstIndex == 0 || !tileState().entries[firstIndex - 1].isEmpty())
         {
             return;
         }
 
+        // Move the tile to the start of the free run before it
+        const auto holeLength = _freeRunTags[firstIndex - 1].length;
+        const auto holeStart = firstIndex - holeLength;
+        auto* emptyTile = &tileState().entries[holeStart];
+
         tileState().tiles[_periodicDefragStartTile] = emptyTile;
+        const auto numEntries = countTileEntries(firstTile);
+        reserveEntryRange(holeStart, holeLength);
         {
             auto* dest = emptyTile;
             auto* source = firstTile;
@@ -916,14 +1192,9 @@ namespace OpenLoco::World::TileManager
             } while (!dest++->isLast());
         }
 
-        // Its possible we have freed up elements at the end so this
-        // looks to see if we should move the element end
-        auto newEnd = tileState().entriesEnd - 1;
-        while (newEnd >= 0 && tileState().entries[newEnd].isEmpty())
-        {
-            newEnd--;
-        }
-        tileState().entriesEnd = newEnd + 1;
+        // The hole is now after the tile. Its possible we have freed up elements at
+        // the end, releasing it moves the element end back if so
+        releaseEntryRange(holeStart + numEntries, holeLength);
     }
 
     // 0x00461393
@@ -1212,6 +1483,7 @@ namespace OpenLoco::World::TileManager
             return;
         }
 
+        OPENLOCO_PROFILE_ZONE("TileManager::tick");
         GameCommands::setUpdatingCompanyId(CompanyId::neutral);
         auto pos = getGameState().tileUpdateStartLocation;
         for (; pos.y < World::kMapHeight; pos.y += 16 * World::kTileSize)
@@ -1331,6 +1603,7 @@ namespace OpenLoco::World::TileManager
             }
         }
         Ui::ViewportManager::invalidate(pos, elBuilding.baseHeight(), elBuilding.clearHeight(), ZoomLevel::eighth);
+        OpenLoco::invalidateCargoContribution(toTileSpace(pos));
         TileManager::removeElement(entry);
     }
 
@@ -1458,6 +1731,7 @@ namespace OpenLoco::World::TileManager
                     elRoad.setLevelCrossingClosed(false);
                     elRoad.setLevelCrossingObjectId(0);
                 } });
+            Track::invalidateTrackNetwork();
         }
     }
 
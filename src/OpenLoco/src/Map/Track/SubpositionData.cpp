@@ -10,7 +10,7 @@ namespace OpenLoco::World::TrackData
 #pragma region TrackData
     // 0x4da526
     // Track 0. Reversed 0. Direction 0
-    static constexpr auto moveInfoT0R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT0R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::flat },
             { { 30, 16, 0 }, 0, Pitch::flat },
@@ -44,11 +44,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 16, 0 }, 0, Pitch::flat },
             { { 1, 16, 0 }, 0, Pitch::flat },
             { { 0, 16, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4da628
     // Track 0. Reversed 0. Direction 1
-    static constexpr auto moveInfoT0R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT0R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::flat },
             { { 16, 1, 0 }, 16, Pitch::flat },
@@ -82,11 +82,11 @@ namespace OpenLoco::World::TrackData
             { { 16, 29, 0 }, 16, Pitch::flat },
             { { 16, 30, 0 }, 16, Pitch::flat },
             { { 16, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4da72a
     // Track 0. Reversed 0. Direction 2
-    static constexpr auto moveInfoT0R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT0R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::flat },
             { { 1, 16, 0 }, 32, Pitch::flat },
@@ -120,11 +120,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 16, 0 }, 32, Pitch::flat },
             { { 30, 16, 0 }, 32, Pitch::flat },
             { { 31, 16, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4da82c
     // Track 0. Reversed 0. Direction 3
-    static constexpr auto moveInfoT0R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT0R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::flat },
             { { 16, 30, 0 }, 48, Pitch::flat },
@@ -158,11 +158,11 @@ namespace OpenLoco::World::TrackData
             { { 16, 2, 0 }, 48, Pitch::flat },
             { { 16, 1, 0 }, 48, Pitch::flat },
             { { 16, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4dc14e
     // Track 1. Reversed 0. Direction 0
-    static constexpr auto moveInfoT1R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT1R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 15, 16, 0 }, 8, Pitch::flat },
             { { 14, 17, 0 }, 8, Pitch::flat },
@@ -196,11 +196,11 @@ namespace OpenLoco::World::TrackData
             { { -14, 45, 0 }, 8, Pitch::flat },
             { { -15, 46, 0 }, 8, Pitch::flat },
             { { -16, 47, 0 }, 8, Pitch::flat },
-        });
+        }));
 
     // 0x4dc250
     // Track 1. Reversed 0. Direction 1
-    static constexpr auto moveInfoT1R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT1R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 16, 0 }, 24, Pitch::flat },
             { { 17, 17, 0 }, 24, Pitch::flat },
@@ -234,11 +234,11 @@ namespace OpenLoco::World::TrackData
             { { 45, 45, 0 }, 24, Pitch::flat },
             { { 46, 46, 0 }, 24, Pitch::flat },
             { { 47, 47, 0 }, 24, Pitch::flat },
-        });
+        }));
 
     // 0x4dc352
     // Track 1. Reversed 0. Direction 2
-    static constexpr auto moveInfoT1R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT1R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 15, 0 }, 40, Pitch::flat },
             { { 17, 14, 0 }, 40, Pitch::flat },
@@ -272,11 +272,11 @@ namespace OpenLoco::World::TrackData
             { { 45, -14, 0 }, 40, Pitch::flat },
             { { 46, -15, 0 }, 40, Pitch::flat },
             { { 47, -16, 0 }, 40, Pitch::flat },
-        });
+        }));
 
     // 0x4dc454
     // Track 1. Reversed 0. Direction 3
-    static constexpr auto moveInfoT1R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT1R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 15, 15, 0 }, 56, Pitch::flat },
             { { 14, 14, 0 }, 56, Pitch::flat },
@@ -310,11 +310,11 @@ namespace OpenLoco::World::TrackData
             { { -14, -14, 0 }, 56, Pitch::flat },
             { { -15, -15, 0 }, 56, Pitch::flat },
             { { -16, -16, 0 }, 56, Pitch::flat },
-        });
+        }));
 
     // 0x4df376
     // Track 2. Reversed 0. Direction 0
-    static constexpr auto moveInfoT2R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT2R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::flat },
             { { 30, 16, 0 }, 0, Pitch::flat },
@@ -338,11 +338,11 @@ namespace OpenLoco::World::TrackData
             { { 16, 2, 0 }, 48, Pitch::flat },
             { { 16, 1, 0 }, 48, Pitch::flat },
             { { 16, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4df428
     // Track 2. Reversed 0. Direction 1
-    static constexpr auto moveInfoT2R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT2R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::flat },
             { { 16, 1, 0 }, 16, Pitch::flat },
@@ -367,11 +367,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 16, 0 }, 0, Pitch::flat },
             { { 1, 16, 0 }, 0, Pitch::flat },
             { { 0, 16, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4df4e2
     // Track 2. Reversed 0. Direction 2
-    static constexpr auto moveInfoT2R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT2R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::flat },
             { { 1, 16, 0 }, 32, Pitch::flat },
@@ -395,11 +395,11 @@ namespace OpenLoco::World::TrackData
             { { 16, 29, 0 }, 18, Pitch::flat },
             { { 16, 30, 0 }, 16, Pitch::flat },
             { { 16, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4df594
     // Track 2. Reversed 0. Direction 3
-    static constexpr auto moveInfoT2R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT2R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::flat },
             { { 16, 30, 0 }, 48, Pitch::flat },
@@ -422,11 +422,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 16, 0 }, 34, Pitch::flat },
             { { 30, 16, 0 }, 32, Pitch::flat },
             { { 31, 16, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4df6e8
     // Track 2. Reversed 1. Direction 0
-    static constexpr auto moveInfoT2R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT2R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::flat },
             { { 16, 1, 0 }, 16, Pitch::flat },
@@ -450,11 +450,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 16, 0 }, 30, Pitch::flat },
             { { 30, 16, 0 }, 32, Pitch::flat },
             { { 31, 16, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4df79a
     // Track 2. Reversed 1. Direction 1
-    static constexpr auto moveInfoT2R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT2R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::flat },
             { { 1, 16, 0 }, 32, Pitch::flat },
@@ -479,11 +479,11 @@ namespace OpenLoco::World::TrackData
             { { 16, 2, 0 }, 48, Pitch::flat },
             { { 16, 1, 0 }, 48, Pitch::flat },
             { { 16, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4df854
     // Track 2. Reversed 1. Direction 2
-    static constexpr auto moveInfoT2R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT2R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::flat },
             { { 16, 30, 0 }, 48, Pitch::flat },
@@ -507,11 +507,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 16, 0 }, 0, Pitch::flat },
             { { 1, 16, 0 }, 0, Pitch::flat },
             { { 0, 16, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4df63e
     // Track 2. Reversed 1. Direction 3
-    static constexpr auto moveInfoT2R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT2R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::flat },
             { { 30, 16, 0 }, 0, Pitch::flat },
@@ -534,11 +534,11 @@ namespace OpenLoco::World::TrackData
             { { 16, 29, 0 }, 14, Pitch::flat },
             { { 16, 30, 0 }, 16, Pitch::flat },
             { { 16, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4df906
     // Track 4. Reversed 0. Direction 0
-    static constexpr auto moveInfoT4R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT4R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::flat },
             { { 30, 16, 0 }, 0, Pitch::flat },
@@ -608,11 +608,11 @@ namespace OpenLoco::World::TrackData
             { { -16, -29, 0 }, 48, Pitch::flat },
             { { -16, -30, 0 }, 48, Pitch::flat },
             { { -16, -31, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4dfb28
     // Track 4. Reversed 0. Direction 1
-    static constexpr auto moveInfoT4R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT4R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::flat },
             { { 16, 1, 0 }, 16, Pitch::flat },
@@ -683,11 +683,11 @@ namespace OpenLoco::World::TrackData
             { { -29, 48, 0 }, 0, Pitch::flat },
             { { -30, 48, 0 }, 0, Pitch::flat },
             { { -31, 48, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4dfd52
     // Track 4. Reversed 0. Direction 2
-    static constexpr auto moveInfoT4R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT4R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::flat },
             { { 1, 16, 0 }, 32, Pitch::flat },
@@ -757,11 +757,11 @@ namespace OpenLoco::World::TrackData
             { { 48, 60, 0 }, 16, Pitch::flat },
             { { 48, 61, 0 }, 16, Pitch::flat },
             { { 48, 62, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4dff74
     // Track 4. Reversed 0. Direction 3
-    static constexpr auto moveInfoT4R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT4R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::flat },
             { { 16, 30, 0 }, 48, Pitch::flat },
@@ -830,11 +830,11 @@ namespace OpenLoco::World::TrackData
             { { 60, -16, 0 }, 32, Pitch::flat },
             { { 61, -16, 0 }, 32, Pitch::flat },
             { { 62, -16, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4e03a8
     // Track 4. Reversed 1. Direction 0
-    static constexpr auto moveInfoT4R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT4R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::flat },
             { { 16, 1, 0 }, 16, Pitch::flat },
@@ -904,11 +904,11 @@ namespace OpenLoco::World::TrackData
             { { 60, 48, 0 }, 32, Pitch::flat },
             { { 61, 48, 0 }, 32, Pitch::flat },
             { { 62, 48, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4e05ca
     // Track 4. Reversed 1. Direction 1
-    static constexpr auto moveInfoT4R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT4R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::flat },
             { { 1, 16, 0 }, 32, Pitch::flat },
@@ -979,11 +979,11 @@ namespace OpenLoco::World::TrackData
             { { 48, -29, 0 }, 48, Pitch::flat },
             { { 48, -30, 0 }, 48, Pitch::flat },
             { { 48, -31, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4e07f4
     // Track 4. Reversed 1. Direction 2
-    static constexpr auto moveInfoT4R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT4R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::flat },
             { { 16, 30, 0 }, 48, Pitch::flat },
@@ -1053,11 +1053,11 @@ namespace OpenLoco::World::TrackData
             { { -29, -16, 0 }, 0, Pitch::flat },
             { { -30, -16, 0 }, 0, Pitch::flat },
             { { -31, -16, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4e018e
     // Track 4. Reversed 1. Direction 3
-    static constexpr auto moveInfoT4R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT4R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::flat },
             { { 30, 16, 0 }, 0, Pitch::flat },
@@ -1126,11 +1126,11 @@ namespace OpenLoco::World::TrackData
             { { -16, 60, 0 }, 16, Pitch::flat },
             { { -16, 61, 0 }, 16, Pitch::flat },
             { { -16, 62, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4e0a16
     // Track 6. Reversed 0. Direction 0
-    static constexpr auto moveInfoT6R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT6R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::flat },
             { { 30, 16, 0 }, 0, Pitch::flat },
@@ -1246,11 +1246,11 @@ namespace OpenLoco::World::TrackData
             { { -48, -62, 0 }, 48, Pitch::flat },
             { { -48, -63, 0 }, 48, Pitch::flat },
             { { -48, -64, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4e0da8
     // Track 6. Reversed 0. Direction 1
-    static constexpr auto moveInfoT6R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT6R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::flat },
             { { 16, 1, 0 }, 16, Pitch::flat },
@@ -1367,11 +1367,11 @@ namespace OpenLoco::World::TrackData
             { { -62, 80, 0 }, 0, Pitch::flat },
             { { -63, 80, 0 }, 0, Pitch::flat },
             { { -64, 80, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4e1142
     // Track 6. Reversed 0. Direction 2
-    static constexpr auto moveInfoT6R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT6R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::flat },
             { { 1, 16, 0 }, 32, Pitch::flat },
@@ -1487,11 +1487,11 @@ namespace OpenLoco::World::TrackData
             { { 80, 93, 0 }, 16, Pitch::flat },
             { { 80, 94, 0 }, 16, Pitch::flat },
             { { 80, 95, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4e14d4
     // Track 6. Reversed 0. Direction 3
-    static constexpr auto moveInfoT6R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT6R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::flat },
             { { 16, 30, 0 }, 48, Pitch::flat },
@@ -1606,11 +1606,11 @@ namespace OpenLoco::World::TrackData
             { { 93, -48, 0 }, 32, Pitch::flat },
             { { 94, -48, 0 }, 32, Pitch::flat },
             { { 95, -48, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4e1be8
     // Track 6. Reversed 1. Direction 0
-    static constexpr auto moveInfoT6R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT6R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::flat },
             { { 16, 1, 0 }, 16, Pitch::flat },
@@ -1726,11 +1726,11 @@ namespace OpenLoco::World::TrackData
             { { 93, 80, 0 }, 32, Pitch::flat },
             { { 94, 80, 0 }, 32, Pitch::flat },
             { { 95, 80, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4e1f7a
     // Track 6. Reversed 1. Direction 1
-    static constexpr auto moveInfoT6R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT6R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::flat },
             { { 1, 16, 0 }, 32, Pitch::flat },
@@ -1847,11 +1847,11 @@ namespace OpenLoco::World::TrackData
             { { 80, -62, 0 }, 48, Pitch::flat },
             { { 80, -63, 0 }, 48, Pitch::flat },
             { { 80, -64, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4e2314
     // Track 6. Reversed 1. Direction 2
-    static constexpr auto moveInfoT6R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT6R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::flat },
             { { 16, 30, 0 }, 48, Pitch::flat },
@@ -1967,11 +1967,11 @@ namespace OpenLoco::World::TrackData
             { { -62, -48, 0 }, 0, Pitch::flat },
             { { -63, -48, 0 }, 0, Pitch::flat },
             { { -64, -48, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4e185e
     // Track 6. Reversed 1. Direction 3
-    static constexpr auto moveInfoT6R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT6R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::flat },
             { { 30, 16, 0 }, 0, Pitch::flat },
@@ -2086,11 +2086,11 @@ namespace OpenLoco::World::TrackData
             { { -48, 93, 0 }, 16, Pitch::flat },
             { { -48, 94, 0 }, 16, Pitch::flat },
             { { -48, 95, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4e26a6
     // Track 8. Reversed 0. Direction 0
-    static constexpr auto moveInfoT8R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT8R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::flat },
             { { 30, 16, 0 }, 0, Pitch::flat },
@@ -2171,11 +2171,11 @@ namespace OpenLoco::World::TrackData
             { { -45, -14, 0 }, 56, Pitch::flat },
             { { -46, -15, 0 }, 56, Pitch::flat },
             { { -47, -16, 0 }, 56, Pitch::flat },
-        });
+        }));
 
     // 0x4e2920
     // Track 8. Reversed 0. Direction 1
-    static constexpr auto moveInfoT8R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT8R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::flat },
             { { 16, 1, 0 }, 16, Pitch::flat },
@@ -2257,11 +2257,11 @@ namespace OpenLoco::World::TrackData
             { { -14, 77, 0 }, 8, Pitch::flat },
             { { -15, 78, 0 }, 8, Pitch::flat },
             { { -16, 79, 0 }, 8, Pitch::flat },
-        });
+        }));
 
     // 0x4e2ba2
     // Track 8. Reversed 0. Direction 2
-    static constexpr auto moveInfoT8R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT8R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::flat },
             { { 1, 16, 0 }, 32, Pitch::flat },
@@ -2343,11 +2343,11 @@ namespace OpenLoco::World::TrackData
             { { 77, 45, 0 }, 24, Pitch::flat },
             { { 78, 46, 0 }, 24, Pitch::flat },
             { { 79, 47, 0 }, 24, Pitch::flat },
-        });
+        }));
 
     // 0x4e2e24
     // Track 8. Reversed 0. Direction 3
-    static constexpr auto moveInfoT8R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT8R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::flat },
             { { 16, 30, 0 }, 48, Pitch::flat },
@@ -2429,11 +2429,11 @@ namespace OpenLoco::World::TrackData
             { { 45, -46, 0 }, 40, Pitch::flat },
             { { 46, -47, 0 }, 40, Pitch::flat },
             { { 47, -48, 0 }, 40, Pitch::flat },
-        });
+        }));
 
     // 0x4e4728
     // Track 8. Reversed 1. Direction 0
-    static constexpr auto moveInfoT8R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT8R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 16, 0 }, 24, Pitch::flat },
             { { 17, 17, 0 }, 24, Pitch::flat },
@@ -2515,11 +2515,11 @@ namespace OpenLoco::World::TrackData
             { { 93, 48, 0 }, 32, Pitch::flat },
             { { 94, 48, 0 }, 32, Pitch::flat },
             { { 95, 48, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4e49aa
     // Track 8. Reversed 1. Direction 1
-    static constexpr auto moveInfoT8R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT8R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 15, 0 }, 40, Pitch::flat },
             { { 17, 14, 0 }, 40, Pitch::flat },
@@ -2601,11 +2601,11 @@ namespace OpenLoco::World::TrackData
             { { 47, -62, 0 }, 48, Pitch::flat },
             { { 47, -63, 0 }, 48, Pitch::flat },
             { { 47, -64, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4e4c2c
     // Track 8. Reversed 1. Direction 2
-    static constexpr auto moveInfoT8R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT8R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 15, 15, 0 }, 56, Pitch::flat },
             { { 14, 14, 0 }, 56, Pitch::flat },
@@ -2687,11 +2687,11 @@ namespace OpenLoco::World::TrackData
             { { -62, -16, 0 }, 0, Pitch::flat },
             { { -63, -16, 0 }, 0, Pitch::flat },
             { { -64, -16, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4e44ae
     // Track 8. Reversed 1. Direction 3
-    static constexpr auto moveInfoT8R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT8R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 15, 17, 0 }, 8, Pitch::flat },
             { { 14, 18, 0 }, 8, Pitch::flat },
@@ -2772,11 +2772,11 @@ namespace OpenLoco::World::TrackData
             { { -16, 93, 0 }, 16, Pitch::flat },
             { { -16, 94, 0 }, 16, Pitch::flat },
             { { -16, 95, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4e3aa6
     // Track 9. Reversed 0. Direction 0
-    static constexpr auto moveInfoT9R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT9R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::flat },
             { { 30, 16, 0 }, 0, Pitch::flat },
@@ -2858,11 +2858,11 @@ namespace OpenLoco::World::TrackData
             { { -46, 45, 0 }, 8, Pitch::flat },
             { { -47, 46, 0 }, 8, Pitch::flat },
             { { -48, 47, 0 }, 8, Pitch::flat },
-        });
+        }));
 
     // 0x4e3d28
     // Track 9. Reversed 0. Direction 1
-    static constexpr auto moveInfoT9R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT9R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::flat },
             { { 16, 1, 0 }, 16, Pitch::flat },
@@ -2944,11 +2944,11 @@ namespace OpenLoco::World::TrackData
             { { 45, 77, 0 }, 24, Pitch::flat },
             { { 46, 78, 0 }, 24, Pitch::flat },
             { { 47, 79, 0 }, 24, Pitch::flat },
-        });
+        }));
 
     // 0x4e3faa
     // Track 9. Reversed 0. Direction 2
-    static constexpr auto moveInfoT9R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT9R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::flat },
             { { 1, 16, 0 }, 32, Pitch::flat },
@@ -3030,11 +3030,11 @@ namespace OpenLoco::World::TrackData
             { { 77, -14, 0 }, 40, Pitch::flat },
             { { 78, -15, 0 }, 40, Pitch::flat },
             { { 79, -16, 0 }, 40, Pitch::flat },
-        });
+        }));
 
     // 0x4e422c
     // Track 9. Reversed 0. Direction 3
-    static constexpr auto moveInfoT9R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT9R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::flat },
             { { 16, 30, 0 }, 48, Pitch::flat },
@@ -3116,11 +3116,11 @@ namespace OpenLoco::World::TrackData
             { { -14, -46, 0 }, 56, Pitch::flat },
             { { -15, -47, 0 }, 56, Pitch::flat },
             { { -16, -48, 0 }, 56, Pitch::flat },
-        });
+        }));
 
     // 0x4e35a2
     // Track 9. Reversed 1. Direction 0
-    static constexpr auto moveInfoT9R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT9R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 15, 0 }, 40, Pitch::flat },
             { { 17, 14, 0 }, 40, Pitch::flat },
@@ -3202,11 +3202,11 @@ namespace OpenLoco::World::TrackData
             { { 93, -16, 0 }, 32, Pitch::flat },
             { { 94, -16, 0 }, 32, Pitch::flat },
             { { 95, -16, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4e3824
     // Track 9. Reversed 1. Direction 1
-    static constexpr auto moveInfoT9R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT9R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 15, 15, 0 }, 56, Pitch::flat },
             { { 14, 14, 0 }, 56, Pitch::flat },
@@ -3288,11 +3288,11 @@ namespace OpenLoco::World::TrackData
             { { -16, -62, 0 }, 48, Pitch::flat },
             { { -16, -63, 0 }, 48, Pitch::flat },
             { { -16, -64, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4e30a6
     // Track 9. Reversed 1. Direction 2
-    static constexpr auto moveInfoT9R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT9R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 15, 17, 0 }, 8, Pitch::flat },
             { { 14, 18, 0 }, 8, Pitch::flat },
@@ -3373,11 +3373,11 @@ namespace OpenLoco::World::TrackData
             { { -61, 48, 0 }, 0, Pitch::flat },
             { { -62, 48, 0 }, 0, Pitch::flat },
             { { -63, 48, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4e3320
     // Track 9. Reversed 1. Direction 3
-    static constexpr auto moveInfoT9R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT9R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 16, 0 }, 24, Pitch::flat },
             { { 17, 17, 0 }, 24, Pitch::flat },
@@ -3459,11 +3459,11 @@ namespace OpenLoco::World::TrackData
             { { 48, 93, 0 }, 16, Pitch::flat },
             { { 48, 94, 0 }, 16, Pitch::flat },
             { { 48, 95, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4e4eae
     // Track 12. Reversed 0. Direction 0
-    static constexpr auto moveInfoT12R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT12R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 32, 16, 0 }, 0, Pitch::flat },
             { { 31, 16, 0 }, 0, Pitch::flat },
@@ -3561,11 +3561,11 @@ namespace OpenLoco::World::TrackData
             { { -61, -16, 0 }, 0, Pitch::flat },
             { { -62, -16, 0 }, 0, Pitch::flat },
             { { -63, -16, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4e51b0
     // Track 12. Reversed 0. Direction 1
-    static constexpr auto moveInfoT12R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT12R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::flat },
             { { 16, 1, 0 }, 16, Pitch::flat },
@@ -3663,11 +3663,11 @@ namespace OpenLoco::World::TrackData
             { { -16, 93, 0 }, 16, Pitch::flat },
             { { -16, 94, 0 }, 16, Pitch::flat },
             { { -16, 95, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4e54b2
     // Track 12. Reversed 0. Direction 2
-    static constexpr auto moveInfoT12R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT12R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::flat },
             { { 1, 16, 0 }, 32, Pitch::flat },
@@ -3765,11 +3765,11 @@ namespace OpenLoco::World::TrackData
             { { 93, 48, 0 }, 32, Pitch::flat },
             { { 94, 48, 0 }, 32, Pitch::flat },
             { { 95, 48, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4e57b4
     // Track 12. Reversed 0. Direction 3
-    static constexpr auto moveInfoT12R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT12R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 32, 0 }, 48, Pitch::flat },
             { { 16, 31, 0 }, 48, Pitch::flat },
@@ -3867,11 +3867,11 @@ namespace OpenLoco::World::TrackData
             { { 48, -61, 0 }, 48, Pitch::flat },
             { { 48, -62, 0 }, 48, Pitch::flat },
             { { 48, -63, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4e5ab6
     // Track 13. Reversed 0. Direction 0
-    static constexpr auto moveInfoT13R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT13R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 32, 16, 0 }, 0, Pitch::flat },
             { { 31, 16, 0 }, 0, Pitch::flat },
@@ -3969,11 +3969,11 @@ namespace OpenLoco::World::TrackData
             { { -61, 48, 0 }, 0, Pitch::flat },
             { { -62, 48, 0 }, 0, Pitch::flat },
             { { -63, 48, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4e5db8
     // Track 13. Reversed 0. Direction 1
-    static constexpr auto moveInfoT13R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT13R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::flat },
             { { 16, 1, 0 }, 16, Pitch::flat },
@@ -4071,11 +4071,11 @@ namespace OpenLoco::World::TrackData
             { { 48, 93, 0 }, 16, Pitch::flat },
             { { 48, 94, 0 }, 16, Pitch::flat },
             { { 48, 95, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4e60ba
     // Track 13. Reversed 0. Direction 2
-    static constexpr auto moveInfoT13R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT13R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::flat },
             { { 1, 16, 0 }, 32, Pitch::flat },
@@ -4173,11 +4173,11 @@ namespace OpenLoco::World::TrackData
             { { 93, -16, 0 }, 32, Pitch::flat },
             { { 94, -16, 0 }, 32, Pitch::flat },
             { { 95, -16, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4e63bc
     // Track 13. Reversed 0. Direction 3
-    static constexpr auto moveInfoT13R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT13R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 32, 0 }, 48, Pitch::flat },
             { { 16, 31, 0 }, 48, Pitch::flat },
@@ -4275,11 +4275,11 @@ namespace OpenLoco::World::TrackData
             { { -16, -61, 0 }, 48, Pitch::flat },
             { { -16, -62, 0 }, 48, Pitch::flat },
             { { -16, -63, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4da92e
     // Track 14. Reversed 0. Direction 0
-    static constexpr auto moveInfoT14R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT14R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::up12deg },
             { { 30, 16, 0 }, 0, Pitch::up12deg },
@@ -4345,11 +4345,11 @@ namespace OpenLoco::World::TrackData
             { { -30, 16, 15 }, 0, Pitch::up12deg },
             { { -31, 16, 15 }, 0, Pitch::up12deg },
             { { -32, 16, 15 }, 0, Pitch::up12deg },
-        });
+        }));
 
     // 0x4dab30
     // Track 14. Reversed 0. Direction 1
-    static constexpr auto moveInfoT14R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT14R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::up12deg },
             { { 16, 1, 0 }, 16, Pitch::up12deg },
@@ -4415,11 +4415,11 @@ namespace OpenLoco::World::TrackData
             { { 16, 61, 15 }, 16, Pitch::up12deg },
             { { 16, 62, 15 }, 16, Pitch::up12deg },
             { { 16, 63, 15 }, 16, Pitch::up12deg },
-        });
+        }));
 
     // 0x4dad32
     // Track 14. Reversed 0. Direction 2
-    static constexpr auto moveInfoT14R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT14R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::up12deg },
             { { 1, 16, 0 }, 32, Pitch::up12deg },
@@ -4485,11 +4485,11 @@ namespace OpenLoco::World::TrackData
             { { 61, 16, 15 }, 32, Pitch::up12deg },
             { { 62, 16, 15 }, 32, Pitch::up12deg },
             { { 63, 16, 15 }, 32, Pitch::up12deg },
-        });
+        }));
 
     // 0x4daf34
     // Track 14. Reversed 0. Direction 3
-    static constexpr auto moveInfoT14R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT14R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::up12deg },
             { { 16, 30, 0 }, 48, Pitch::up12deg },
@@ -4555,11 +4555,11 @@ namespace OpenLoco::World::TrackData
             { { 16, -30, 15 }, 48, Pitch::up12deg },
             { { 16, -31, 15 }, 48, Pitch::up12deg },
             { { 16, -32, 15 }, 48, Pitch::up12deg },
-        });
+        }));
 
     // 0x4db53a
     // Track 14. Reversed 1. Direction 0
-    static constexpr auto moveInfoT14R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT14R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::down12deg },
             { { 1, 16, 0 }, 32, Pitch::down12deg },
@@ -4625,11 +4625,11 @@ namespace OpenLoco::World::TrackData
             { { 61, 16, -15 }, 32, Pitch::down12deg },
             { { 62, 16, -15 }, 32, Pitch::down12deg },
             { { 63, 16, -15 }, 32, Pitch::down12deg },
-        });
+        }));
 
     // 0x4db73c
     // Track 14. Reversed 1. Direction 1
-    static constexpr auto moveInfoT14R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT14R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::down12deg },
             { { 16, 30, 0 }, 48, Pitch::down12deg },
@@ -4695,11 +4695,11 @@ namespace OpenLoco::World::TrackData
             { { 16, -30, -15 }, 48, Pitch::down12deg },
             { { 16, -31, -15 }, 48, Pitch::down12deg },
             { { 16, -32, -15 }, 48, Pitch::down12deg },
-        });
+        }));
 
     // 0x4db136
     // Track 14. Reversed 1. Direction 2
-    static constexpr auto moveInfoT14R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT14R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::down12deg },
             { { 30, 16, 0 }, 0, Pitch::down12deg },
@@ -4765,11 +4765,11 @@ namespace OpenLoco::World::TrackData
             { { -30, 16, -15 }, 0, Pitch::down12deg },
             { { -31, 16, -15 }, 0, Pitch::down12deg },
             { { -32, 16, -15 }, 0, Pitch::down12deg },
-        });
+        }));
 
     // 0x4db338
     // Track 14. Reversed 1. Direction 3
-    static constexpr auto moveInfoT14R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT14R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::down12deg },
             { { 16, 1, 0 }, 16, Pitch::down12deg },
@@ -4835,11 +4835,11 @@ namespace OpenLoco::World::TrackData
             { { 16, 61, -15 }, 16, Pitch::down12deg },
             { { 16, 62, -15 }, 16, Pitch::down12deg },
             { { 16, 63, -15 }, 16, Pitch::down12deg },
-        });
+        }));
 
     // 0x4db93e
     // Track 16. Reversed 0. Direction 0
-    static constexpr auto moveInfoT16R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT16R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::up25deg },
             { { 30, 16, 0 }, 0, Pitch::up25deg },
@@ -4873,11 +4873,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 16, 14 }, 0, Pitch::up25deg },
             { { 1, 16, 15 }, 0, Pitch::up25deg },
             { { 0, 16, 15 }, 0, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dba40
     // Track 16. Reversed 0. Direction 1
-    static constexpr auto moveInfoT16R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT16R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::up25deg },
             { { 16, 1, 0 }, 16, Pitch::up25deg },
@@ -4911,11 +4911,11 @@ namespace OpenLoco::World::TrackData
             { { 16, 29, 14 }, 16, Pitch::up25deg },
             { { 16, 30, 15 }, 16, Pitch::up25deg },
             { { 16, 31, 15 }, 16, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dbb42
     // Track 16. Reversed 0. Direction 2
-    static constexpr auto moveInfoT16R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT16R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::up25deg },
             { { 1, 16, 0 }, 32, Pitch::up25deg },
@@ -4949,11 +4949,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 16, 14 }, 32, Pitch::up25deg },
             { { 30, 16, 15 }, 32, Pitch::up25deg },
             { { 31, 16, 15 }, 32, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dbc44
     // Track 16. Reversed 0. Direction 3
-    static constexpr auto moveInfoT16R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT16R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::up25deg },
             { { 16, 30, 0 }, 48, Pitch::up25deg },
@@ -4987,11 +4987,11 @@ namespace OpenLoco::World::TrackData
             { { 16, 2, 14 }, 48, Pitch::up25deg },
             { { 16, 1, 15 }, 48, Pitch::up25deg },
             { { 16, 0, 15 }, 48, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dbf4a
     // Track 16. Reversed 1. Direction 0
-    static constexpr auto moveInfoT16R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT16R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::down25deg },
             { { 1, 16, 0 }, 32, Pitch::down25deg },
@@ -5025,11 +5025,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 16, -14 }, 32, Pitch::down25deg },
             { { 30, 16, -15 }, 32, Pitch::down25deg },
             { { 31, 16, -15 }, 32, Pitch::down25deg },
-        });
+        }));
 
     // 0x4dc04c
     // Track 16. Reversed 1. Direction 1
-    static constexpr auto moveInfoT16R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT16R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::down25deg },
             { { 16, 30, 0 }, 48, Pitch::down25deg },
@@ -5063,11 +5063,11 @@ namespace OpenLoco::World::TrackData
             { { 16, 2, -14 }, 48, Pitch::down25deg },
             { { 16, 1, -15 }, 48, Pitch::down25deg },
             { { 16, 0, -15 }, 48, Pitch::down25deg },
-        });
+        }));
 
     // 0x4dbd46
     // Track 16. Reversed 1. Direction 2
-    static constexpr auto moveInfoT16R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT16R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::down25deg },
             { { 30, 16, 0 }, 0, Pitch::down25deg },
@@ -5101,11 +5101,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 16, -14 }, 0, Pitch::down25deg },
             { { 1, 16, -15 }, 0, Pitch::down25deg },
             { { 0, 16, -15 }, 0, Pitch::down25deg },
-        });
+        }));
 
     // 0x4dbe48
     // Track 16. Reversed 1. Direction 3
-    static constexpr auto moveInfoT16R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT16R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::down25deg },
             { { 16, 1, 0 }, 16, Pitch::down25deg },
@@ -5139,11 +5139,11 @@ namespace OpenLoco::World::TrackData
             { { 16, 29, -14 }, 16, Pitch::down25deg },
             { { 16, 30, -15 }, 16, Pitch::down25deg },
             { { 16, 31, -15 }, 16, Pitch::down25deg },
-        });
+        }));
 
     // 0x4e66be
     // Track 18. Reversed 0. Direction 0
-    static constexpr auto moveInfoT18R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT18R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::up10deg },
             { { 30, 16, 0 }, 0, Pitch::up10deg },
@@ -5213,11 +5213,11 @@ namespace OpenLoco::World::TrackData
             { { -16, -29, 15 }, 48, Pitch::up10deg },
             { { -16, -30, 15 }, 48, Pitch::up10deg },
             { { -16, -31, 15 }, 48, Pitch::up10deg },
-        });
+        }));
 
     // 0x4e68e0
     // Track 18. Reversed 0. Direction 1
-    static constexpr auto moveInfoT18R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT18R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::up10deg },
             { { 16, 1, 0 }, 16, Pitch::up10deg },
@@ -5288,11 +5288,11 @@ namespace OpenLoco::World::TrackData
             { { -29, 48, 15 }, 0, Pitch::up10deg },
             { { -30, 48, 15 }, 0, Pitch::up10deg },
             { { -31, 48, 15 }, 0, Pitch::up10deg },
-        });
+        }));
 
     // 0x4e6b0a
     // Track 18. Reversed 0. Direction 2
-    static constexpr auto moveInfoT18R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT18R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::up10deg },
             { { 1, 16, 0 }, 32, Pitch::up10deg },
@@ -5362,11 +5362,11 @@ namespace OpenLoco::World::TrackData
             { { 48, 60, 15 }, 16, Pitch::up10deg },
             { { 48, 61, 15 }, 16, Pitch::up10deg },
             { { 48, 62, 15 }, 16, Pitch::up10deg },
-        });
+        }));
 
     // 0x4e6d2c
     // Track 18. Reversed 0. Direction 3
-    static constexpr auto moveInfoT18R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT18R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::up10deg },
             { { 16, 30, 0 }, 48, Pitch::up10deg },
@@ -5435,11 +5435,11 @@ namespace OpenLoco::World::TrackData
             { { 60, -16, 15 }, 32, Pitch::up10deg },
             { { 61, -16, 15 }, 32, Pitch::up10deg },
             { { 62, -16, 15 }, 32, Pitch::up10deg },
-        });
+        }));
 
     // 0x4e8270
     // Track 18. Reversed 1. Direction 0
-    static constexpr auto moveInfoT18R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT18R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::down10deg },
             { { 16, 1, 0 }, 16, Pitch::down10deg },
@@ -5509,11 +5509,11 @@ namespace OpenLoco::World::TrackData
             { { 60, 48, -15 }, 32, Pitch::down10deg },
             { { 61, 48, -15 }, 32, Pitch::down10deg },
             { { 62, 48, -15 }, 32, Pitch::down10deg },
-        });
+        }));
 
     // 0x4e8492
     // Track 18. Reversed 1. Direction 1
-    static constexpr auto moveInfoT18R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT18R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::down10deg },
             { { 1, 16, 0 }, 32, Pitch::down10deg },
@@ -5584,11 +5584,11 @@ namespace OpenLoco::World::TrackData
             { { 48, -29, -15 }, 48, Pitch::down10deg },
             { { 48, -30, -15 }, 48, Pitch::down10deg },
             { { 48, -31, -15 }, 48, Pitch::down10deg },
-        });
+        }));
 
     // 0x4e86bc
     // Track 18. Reversed 1. Direction 2
-    static constexpr auto moveInfoT18R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT18R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::down10deg },
             { { 16, 30, 0 }, 48, Pitch::down10deg },
@@ -5658,11 +5658,11 @@ namespace OpenLoco::World::TrackData
             { { -29, -16, -15 }, 0, Pitch::down10deg },
             { { -30, -16, -15 }, 0, Pitch::down10deg },
             { { -31, -16, -15 }, 0, Pitch::down10deg },
-        });
+        }));
 
     // 0x4e8056
     // Track 18. Reversed 1. Direction 3
-    static constexpr auto moveInfoT18R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT18R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::down10deg },
             { { 30, 16, 0 }, 0, Pitch::down10deg },
@@ -5731,11 +5731,11 @@ namespace OpenLoco::World::TrackData
             { { -16, 60, -15 }, 16, Pitch::down10deg },
             { { -16, 61, -15 }, 16, Pitch::down10deg },
             { { -16, 62, -15 }, 16, Pitch::down10deg },
-        });
+        }));
 
     // 0x4e6f46
     // Track 19. Reversed 0. Direction 0
-    static constexpr auto moveInfoT19R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT19R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::up10deg },
             { { 30, 16, 0 }, 0, Pitch::up10deg },
@@ -5804,11 +5804,11 @@ namespace OpenLoco::World::TrackData
             { { -16, 60, 15 }, 16, Pitch::up10deg },
             { { -16, 61, 15 }, 16, Pitch::up10deg },
             { { -16, 62, 15 }, 16, Pitch::up10deg },
-        });
+        }));
 
     // 0x4e7160
     // Track 19. Reversed 0. Direction 1
-    static constexpr auto moveInfoT19R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT19R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::up10deg },
             { { 16, 1, 0 }, 16, Pitch::up10deg },
@@ -5878,11 +5878,11 @@ namespace OpenLoco::World::TrackData
             { { 60, 48, 15 }, 32, Pitch::up10deg },
             { { 61, 48, 15 }, 32, Pitch::up10deg },
             { { 62, 48, 15 }, 32, Pitch::up10deg },
-        });
+        }));
 
     // 0x4e7382
     // Track 19. Reversed 0. Direction 2
-    static constexpr auto moveInfoT19R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT19R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::up10deg },
             { { 1, 16, 0 }, 32, Pitch::up10deg },
@@ -5953,11 +5953,11 @@ namespace OpenLoco::World::TrackData
             { { 48, -29, 15 }, 48, Pitch::up10deg },
             { { 48, -30, 15 }, 48, Pitch::up10deg },
             { { 48, -31, 15 }, 48, Pitch::up10deg },
-        });
+        }));
 
     // 0x4e75ac
     // Track 19. Reversed 0. Direction 3
-    static constexpr auto moveInfoT19R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT19R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::up10deg },
             { { 16, 30, 0 }, 48, Pitch::up10deg },
@@ -6027,11 +6027,11 @@ namespace OpenLoco::World::TrackData
             { { -29, -16, 15 }, 0, Pitch::up10deg },
             { { -30, -16, 15 }, 0, Pitch::up10deg },
             { { -31, -16, 15 }, 0, Pitch::up10deg },
-        });
+        }));
 
     // 0x4e7e3c
     // Track 19. Reversed 1. Direction 0
-    static constexpr auto moveInfoT19R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT19R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::down10deg },
             { { 16, 30, 0 }, 48, Pitch::down10deg },
@@ -6100,11 +6100,11 @@ namespace OpenLoco::World::TrackData
             { { 60, -16, -15 }, 32, Pitch::down10deg },
             { { 61, -16, -15 }, 32, Pitch::down10deg },
             { { 62, -16, -15 }, 32, Pitch::down10deg },
-        });
+        }));
 
     // 0x4e77ce
     // Track 19. Reversed 1. Direction 1
-    static constexpr auto moveInfoT19R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT19R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::down10deg },
             { { 30, 16, 0 }, 0, Pitch::down10deg },
@@ -6174,11 +6174,11 @@ namespace OpenLoco::World::TrackData
             { { -16, -29, -15 }, 48, Pitch::down10deg },
             { { -16, -30, -15 }, 48, Pitch::down10deg },
             { { -16, -31, -16 }, 48, Pitch::down10deg },
-        });
+        }));
 
     // 0x4e79f0
     // Track 19. Reversed 1. Direction 2
-    static constexpr auto moveInfoT19R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT19R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::down10deg },
             { { 16, 1, 0 }, 16, Pitch::down10deg },
@@ -6249,11 +6249,11 @@ namespace OpenLoco::World::TrackData
             { { -29, 48, -15 }, 0, Pitch::down10deg },
             { { -30, 48, -15 }, 0, Pitch::down10deg },
             { { -31, 48, -16 }, 0, Pitch::down10deg },
-        });
+        }));
 
     // 0x4e7c1a
     // Track 19. Reversed 1. Direction 3
-    static constexpr auto moveInfoT19R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT19R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::down10deg },
             { { 1, 16, 0 }, 32, Pitch::down10deg },
@@ -6323,11 +6323,11 @@ namespace OpenLoco::World::TrackData
             { { 48, 60, -15 }, 16, Pitch::down10deg },
             { { 48, 61, -15 }, 16, Pitch::down10deg },
             { { 48, 62, -15 }, 16, Pitch::down10deg },
-        });
+        }));
 
     // 0x4e88de
     // Track 22. Reversed 0. Direction 0
-    static constexpr auto moveInfoT22R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT22R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::up20deg },
             { { 30, 16, 0 }, 0, Pitch::up20deg },
@@ -6397,11 +6397,11 @@ namespace OpenLoco::World::TrackData
             { { -16, -29, 30 }, 48, Pitch::up20deg },
             { { -16, -30, 31 }, 48, Pitch::up20deg },
             { { -16, -31, 31 }, 48, Pitch::up20deg },
-        });
+        }));
 
     // 0x4e8b00
     // Track 22. Reversed 0. Direction 1
-    static constexpr auto moveInfoT22R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT22R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::up20deg },
             { { 16, 1, 0 }, 16, Pitch::up20deg },
@@ -6472,11 +6472,11 @@ namespace OpenLoco::World::TrackData
             { { -29, 48, 30 }, 0, Pitch::up20deg },
             { { -30, 48, 31 }, 0, Pitch::up20deg },
             { { -31, 48, 31 }, 0, Pitch::up20deg },
-        });
+        }));
 
     // 0x4e8d2a
     // Track 22. Reversed 0. Direction 2
-    static constexpr auto moveInfoT22R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT22R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::up20deg },
             { { 1, 16, 0 }, 32, Pitch::up20deg },
@@ -6546,11 +6546,11 @@ namespace OpenLoco::World::TrackData
             { { 48, 60, 30 }, 16, Pitch::up20deg },
             { { 48, 61, 31 }, 16, Pitch::up20deg },
             { { 48, 62, 31 }, 16, Pitch::up20deg },
-        });
+        }));
 
     // 0x4e8f4c
     // Track 22. Reversed 0. Direction 3
-    static constexpr auto moveInfoT22R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT22R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::up20deg },
             { { 16, 30, 0 }, 48, Pitch::up20deg },
@@ -6619,11 +6619,11 @@ namespace OpenLoco::World::TrackData
             { { 60, -16, 30 }, 32, Pitch::up20deg },
             { { 61, -16, 31 }, 32, Pitch::up20deg },
             { { 62, -16, 31 }, 32, Pitch::up20deg },
-        });
+        }));
 
     // 0x4ea490
     // Track 22. Reversed 1. Direction 0
-    static constexpr auto moveInfoT22R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT22R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::down20deg },
             { { 16, 1, 0 }, 16, Pitch::down20deg },
@@ -6693,11 +6693,11 @@ namespace OpenLoco::World::TrackData
             { { 60, 48, -30 }, 32, Pitch::down20deg },
             { { 61, 48, -31 }, 32, Pitch::down20deg },
             { { 62, 48, -31 }, 32, Pitch::down20deg },
-        });
+        }));
 
     // 0x4ea6b2
     // Track 22. Reversed 1. Direction 1
-    static constexpr auto moveInfoT22R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT22R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::down20deg },
             { { 1, 16, 0 }, 32, Pitch::down20deg },
@@ -6768,11 +6768,11 @@ namespace OpenLoco::World::TrackData
             { { 48, -29, -30 }, 48, Pitch::down20deg },
             { { 48, -30, -31 }, 48, Pitch::down20deg },
             { { 48, -31, -31 }, 48, Pitch::down20deg },
-        });
+        }));
 
     // 0x4ea8dc
     // Track 22. Reversed 1. Direction 2
-    static constexpr auto moveInfoT22R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT22R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::down20deg },
             { { 16, 30, 0 }, 48, Pitch::down20deg },
@@ -6842,11 +6842,11 @@ namespace OpenLoco::World::TrackData
             { { -29, -16, -30 }, 0, Pitch::down20deg },
             { { -30, -16, -31 }, 0, Pitch::down20deg },
             { { -31, -16, -31 }, 0, Pitch::down20deg },
-        });
+        }));
 
     // 0x4ea276
     // Track 22. Reversed 1. Direction 3
-    static constexpr auto moveInfoT22R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT22R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::down20deg },
             { { 30, 16, 0 }, 0, Pitch::down20deg },
@@ -6915,11 +6915,11 @@ namespace OpenLoco::World::TrackData
             { { -16, 60, -30 }, 16, Pitch::down20deg },
             { { -16, 61, -31 }, 16, Pitch::down20deg },
             { { -16, 62, -31 }, 16, Pitch::down20deg },
-        });
+        }));
 
     // 0x4e9166
     // Track 23. Reversed 0. Direction 0
-    static constexpr auto moveInfoT23R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT23R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::up20deg },
             { { 30, 16, 0 }, 0, Pitch::up20deg },
@@ -6988,11 +6988,11 @@ namespace OpenLoco::World::TrackData
             { { -16, 60, 30 }, 16, Pitch::up20deg },
             { { -16, 61, 31 }, 16, Pitch::up20deg },
             { { -16, 62, 31 }, 16, Pitch::up20deg },
-        });
+        }));
 
     // 0x4e9380
     // Track 23. Reversed 0. Direction 1
-    static constexpr auto moveInfoT23R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT23R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::up20deg },
             { { 16, 1, 0 }, 16, Pitch::up20deg },
@@ -7062,11 +7062,11 @@ namespace OpenLoco::World::TrackData
             { { 60, 48, 30 }, 32, Pitch::up20deg },
             { { 61, 48, 31 }, 32, Pitch::up20deg },
             { { 62, 48, 31 }, 32, Pitch::up20deg },
-        });
+        }));
 
     // 0x4e95a2
     // Track 23. Reversed 0. Direction 2
-    static constexpr auto moveInfoT23R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT23R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::up20deg },
             { { 1, 16, 0 }, 32, Pitch::up20deg },
@@ -7137,11 +7137,11 @@ namespace OpenLoco::World::TrackData
             { { 48, -29, 30 }, 48, Pitch::up20deg },
             { { 48, -30, 31 }, 48, Pitch::up20deg },
             { { 48, -31, 31 }, 48, Pitch::up20deg },
-        });
+        }));
 
     // 0x4e97cc
     // Track 23. Reversed 0. Direction 3
-    static constexpr auto moveInfoT23R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT23R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::up20deg },
             { { 16, 30, 0 }, 48, Pitch::up20deg },
@@ -7211,11 +7211,11 @@ namespace OpenLoco::World::TrackData
             { { -29, -16, 30 }, 0, Pitch::up20deg },
             { { -30, -16, 31 }, 0, Pitch::up20deg },
             { { -31, -16, 31 }, 0, Pitch::up20deg },
-        });
+        }));
 
     // 0x4ea05c
     // Track 23. Reversed 1. Direction 0
-    static constexpr auto moveInfoT23R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT23R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::down20deg },
             { { 16, 30, 0 }, 48, Pitch::down20deg },
@@ -7284,11 +7284,11 @@ namespace OpenLoco::World::TrackData
             { { 60, -16, -30 }, 32, Pitch::down20deg },
             { { 61, -16, -31 }, 32, Pitch::down20deg },
             { { 62, -16, -31 }, 32, Pitch::down20deg },
-        });
+        }));
 
     // 0x4e99ee
     // Track 23. Reversed 1. Direction 1
-    static constexpr auto moveInfoT23R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT23R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::down20deg },
             { { 30, 16, 0 }, 0, Pitch::down20deg },
@@ -7358,11 +7358,11 @@ namespace OpenLoco::World::TrackData
             { { -16, -29, -30 }, 48, Pitch::down20deg },
             { { -16, -30, -31 }, 48, Pitch::down20deg },
             { { -16, -31, -32 }, 48, Pitch::down20deg },
-        });
+        }));
 
     // 0x4e9c10
     // Track 23. Reversed 1. Direction 2
-    static constexpr auto moveInfoT23R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT23R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::down20deg },
             { { 16, 1, 0 }, 16, Pitch::down20deg },
@@ -7433,11 +7433,11 @@ namespace OpenLoco::World::TrackData
             { { -29, 48, -30 }, 0, Pitch::down20deg },
             { { -30, 48, -31 }, 0, Pitch::down20deg },
             { { -31, 48, -32 }, 0, Pitch::down20deg },
-        });
+        }));
 
     // 0x4e9e3a
     // Track 23. Reversed 1. Direction 3
-    static constexpr auto moveInfoT23R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT23R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::down20deg },
             { { 1, 16, 0 }, 32, Pitch::down20deg },
@@ -7507,11 +7507,11 @@ namespace OpenLoco::World::TrackData
             { { 48, 60, -30 }, 16, Pitch::down20deg },
             { { 48, 61, -31 }, 16, Pitch::down20deg },
             { { 48, 62, -31 }, 16, Pitch::down20deg },
-        });
+        }));
 
     // 0x4dc556
     // Track 26. Reversed 0. Direction 0
-    static constexpr auto moveInfoT26R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT26R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::flat },
             { { 30, 8, 0 }, 0, Pitch::flat },
@@ -7545,11 +7545,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 8, 0 }, 0, Pitch::flat },
             { { 1, 8, 0 }, 0, Pitch::flat },
             { { 0, 8, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4dc658
     // Track 26. Reversed 0. Direction 1
-    static constexpr auto moveInfoT26R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT26R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::flat },
             { { 8, 1, 0 }, 16, Pitch::flat },
@@ -7583,11 +7583,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 29, 0 }, 16, Pitch::flat },
             { { 8, 30, 0 }, 16, Pitch::flat },
             { { 8, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4dc75a
     // Track 26. Reversed 0. Direction 2
-    static constexpr auto moveInfoT26R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT26R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::flat },
             { { 1, 24, 0 }, 32, Pitch::flat },
@@ -7621,11 +7621,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 24, 0 }, 32, Pitch::flat },
             { { 30, 24, 0 }, 32, Pitch::flat },
             { { 31, 24, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4dc85c
     // Track 26. Reversed 0. Direction 3
-    static constexpr auto moveInfoT26R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT26R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::flat },
             { { 24, 30, 0 }, 48, Pitch::flat },
@@ -7659,11 +7659,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 2, 0 }, 48, Pitch::flat },
             { { 24, 1, 0 }, 48, Pitch::flat },
             { { 24, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4dcb62
     // Track 26. Reversed 1. Direction 0
-    static constexpr auto moveInfoT26R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT26R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::flat },
             { { 1, 8, 0 }, 32, Pitch::flat },
@@ -7697,11 +7697,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 8, 0 }, 32, Pitch::flat },
             { { 30, 8, 0 }, 32, Pitch::flat },
             { { 31, 8, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4dcc64
     // Track 26. Reversed 1. Direction 1
-    static constexpr auto moveInfoT26R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT26R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::flat },
             { { 8, 30, 0 }, 48, Pitch::flat },
@@ -7735,11 +7735,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 2, 0 }, 48, Pitch::flat },
             { { 8, 1, 0 }, 48, Pitch::flat },
             { { 8, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4dc95e
     // Track 26. Reversed 1. Direction 2
-    static constexpr auto moveInfoT26R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT26R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::flat },
             { { 30, 24, 0 }, 0, Pitch::flat },
@@ -7773,11 +7773,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 24, 0 }, 0, Pitch::flat },
             { { 1, 24, 0 }, 0, Pitch::flat },
             { { 0, 24, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4dca60
     // Track 26. Reversed 1. Direction 3
-    static constexpr auto moveInfoT26R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT26R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::flat },
             { { 24, 1, 0 }, 16, Pitch::flat },
@@ -7811,11 +7811,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 29, 0 }, 16, Pitch::flat },
             { { 24, 30, 0 }, 16, Pitch::flat },
             { { 24, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4eaafe
     // Track 28. Reversed 0. Direction 0
-    static constexpr auto moveInfoT28R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT28R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::flat },
             { { 30, 8, 0 }, 0, Pitch::flat },
@@ -7829,11 +7829,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 2, 0 }, 48, Pitch::flat },
             { { 24, 1, 0 }, 48, Pitch::flat },
             { { 24, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4eab60
     // Track 28. Reversed 0. Direction 1
-    static constexpr auto moveInfoT28R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT28R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::flat },
             { { 8, 1, 0 }, 16, Pitch::flat },
@@ -7847,11 +7847,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 8, 0 }, 2, Pitch::flat },
             { { 1, 8, 0 }, 0, Pitch::flat },
             { { 0, 8, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4eabc2
     // Track 28. Reversed 0. Direction 2
-    static constexpr auto moveInfoT28R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT28R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::flat },
             { { 1, 24, 0 }, 32, Pitch::flat },
@@ -7865,11 +7865,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 29, 0 }, 18, Pitch::flat },
             { { 8, 30, 0 }, 16, Pitch::flat },
             { { 8, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4eac24
     // Track 28. Reversed 0. Direction 3
-    static constexpr auto moveInfoT28R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT28R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::flat },
             { { 24, 30, 0 }, 48, Pitch::flat },
@@ -7882,11 +7882,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 24, 0 }, 34, Pitch::flat },
             { { 30, 24, 0 }, 32, Pitch::flat },
             { { 31, 24, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4eb0c6
     // Track 28. Reversed 1. Direction 0
-    static constexpr auto moveInfoT28R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT28R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::flat },
             { { 24, 1, 0 }, 16, Pitch::flat },
@@ -7900,11 +7900,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 8, 0 }, 30, Pitch::flat },
             { { 30, 8, 0 }, 32, Pitch::flat },
             { { 31, 8, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4eb128
     // Track 28. Reversed 1. Direction 1
-    static constexpr auto moveInfoT28R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT28R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::flat },
             { { 1, 8, 0 }, 32, Pitch::flat },
@@ -7918,11 +7918,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 2, 0 }, 46, Pitch::flat },
             { { 8, 1, 0 }, 48, Pitch::flat },
             { { 8, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4eb18a
     // Track 28. Reversed 1. Direction 2
-    static constexpr auto moveInfoT28R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT28R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::flat },
             { { 8, 30, 0 }, 48, Pitch::flat },
@@ -7936,11 +7936,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 24, 0 }, 0, Pitch::flat },
             { { 1, 24, 0 }, 0, Pitch::flat },
             { { 0, 24, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4eb1ec
     // Track 28. Reversed 1. Direction 3
-    static constexpr auto moveInfoT28R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT28R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::flat },
             { { 30, 24, 0 }, 0, Pitch::flat },
@@ -7953,11 +7953,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 29, 0 }, 14, Pitch::flat },
             { { 24, 30, 0 }, 16, Pitch::flat },
             { { 24, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4eb350
     // Track 29. Reversed 0. Direction 0
-    static constexpr auto moveInfoT29R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT29R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::flat },
             { { 30, 24, 0 }, 0, Pitch::flat },
@@ -7993,11 +7993,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 2, 0 }, 48, Pitch::flat },
             { { 8, 1, 0 }, 48, Pitch::flat },
             { { 8, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4eb462
     // Track 29. Reversed 0. Direction 1
-    static constexpr auto moveInfoT29R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT29R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::flat },
             { { 24, 1, 0 }, 16, Pitch::flat },
@@ -8034,11 +8034,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 24, 0 }, 0, Pitch::flat },
             { { 1, 24, 0 }, 0, Pitch::flat },
             { { 0, 24, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4eb57c
     // Track 29. Reversed 0. Direction 2
-    static constexpr auto moveInfoT29R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT29R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::flat },
             { { 1, 8, 0 }, 32, Pitch::flat },
@@ -8074,11 +8074,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 29, 0 }, 16, Pitch::flat },
             { { 24, 30, 0 }, 16, Pitch::flat },
             { { 24, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4eb246
     // Track 29. Reversed 0. Direction 3
-    static constexpr auto moveInfoT29R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT29R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::flat },
             { { 8, 30, 0 }, 48, Pitch::flat },
@@ -8113,11 +8113,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 8, 0 }, 32, Pitch::flat },
             { { 30, 8, 0 }, 32, Pitch::flat },
             { { 31, 8, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4ead88
     // Track 29. Reversed 1. Direction 0
-    static constexpr auto moveInfoT29R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT29R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::flat },
             { { 8, 1, 0 }, 16, Pitch::flat },
@@ -8153,11 +8153,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 24, 0 }, 32, Pitch::flat },
             { { 30, 24, 0 }, 32, Pitch::flat },
             { { 31, 24, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4eae9a
     // Track 29. Reversed 1. Direction 1
-    static constexpr auto moveInfoT29R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT29R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::flat },
             { { 1, 24, 0 }, 32, Pitch::flat },
@@ -8194,11 +8194,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 2, 0 }, 48, Pitch::flat },
             { { 24, 1, 0 }, 48, Pitch::flat },
             { { 24, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4eafb4
     // Track 29. Reversed 1. Direction 2
-    static constexpr auto moveInfoT29R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT29R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::flat },
             { { 24, 30, 0 }, 48, Pitch::flat },
@@ -8234,11 +8234,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 8, 0 }, 0, Pitch::flat },
             { { 1, 8, 0 }, 0, Pitch::flat },
             { { 0, 8, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4eac7e
     // Track 29. Reversed 1. Direction 3
-    static constexpr auto moveInfoT29R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT29R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::flat },
             { { 30, 8, 0 }, 0, Pitch::flat },
@@ -8273,11 +8273,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 29, 0 }, 16, Pitch::flat },
             { { 8, 30, 0 }, 16, Pitch::flat },
             { { 8, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4eb68e
     // Track 32. Reversed 0. Direction 0
-    static constexpr auto moveInfoT32R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT32R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::flat },
             { { 30, 8, 0 }, 0, Pitch::flat },
@@ -8311,11 +8311,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 24, 0 }, 0, Pitch::flat },
             { { 1, 24, 0 }, 0, Pitch::flat },
             { { 0, 24, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4eb790
     // Track 32. Reversed 0. Direction 1
-    static constexpr auto moveInfoT32R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT32R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::flat },
             { { 8, 1, 0 }, 16, Pitch::flat },
@@ -8349,11 +8349,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 29, 0 }, 16, Pitch::flat },
             { { 24, 30, 0 }, 16, Pitch::flat },
             { { 24, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4eb892
     // Track 32. Reversed 0. Direction 2
-    static constexpr auto moveInfoT32R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT32R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::flat },
             { { 1, 24, 0 }, 32, Pitch::flat },
@@ -8387,11 +8387,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 8, 0 }, 32, Pitch::flat },
             { { 30, 8, 0 }, 32, Pitch::flat },
             { { 31, 8, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4eb994
     // Track 32. Reversed 0. Direction 3
-    static constexpr auto moveInfoT32R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT32R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::flat },
             { { 24, 30, 0 }, 48, Pitch::flat },
@@ -8425,11 +8425,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 2, 0 }, 48, Pitch::flat },
             { { 8, 1, 0 }, 48, Pitch::flat },
             { { 8, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4eba96
     // Track 33. Reversed 0. Direction 0
-    static constexpr auto moveInfoT33R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT33R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::flat },
             { { 30, 24, 0 }, 0, Pitch::flat },
@@ -8463,11 +8463,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 8, 0 }, 0, Pitch::flat },
             { { 1, 8, 0 }, 0, Pitch::flat },
             { { 0, 8, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4ebb98
     // Track 33. Reversed 0. Direction 1
-    static constexpr auto moveInfoT33R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT33R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::flat },
             { { 24, 1, 0 }, 16, Pitch::flat },
@@ -8501,11 +8501,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 29, 0 }, 16, Pitch::flat },
             { { 8, 30, 0 }, 16, Pitch::flat },
             { { 8, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4ebc9a
     // Track 33. Reversed 0. Direction 2
-    static constexpr auto moveInfoT33R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT33R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::flat },
             { { 1, 8, 0 }, 32, Pitch::flat },
@@ -8539,11 +8539,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 24, 0 }, 32, Pitch::flat },
             { { 30, 24, 0 }, 32, Pitch::flat },
             { { 31, 24, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4ebd9c
     // Track 33. Reversed 0. Direction 3
-    static constexpr auto moveInfoT33R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT33R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::flat },
             { { 8, 30, 0 }, 48, Pitch::flat },
@@ -8577,11 +8577,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 2, 0 }, 48, Pitch::flat },
             { { 24, 1, 0 }, 48, Pitch::flat },
             { { 24, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4dcd66
     // Track 34. Reversed 0. Direction 0
-    static constexpr auto moveInfoT34R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT34R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::up25deg },
             { { 30, 8, 0 }, 0, Pitch::up25deg },
@@ -8615,11 +8615,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 8, 14 }, 0, Pitch::up25deg },
             { { 1, 8, 15 }, 0, Pitch::up25deg },
             { { 0, 8, 15 }, 0, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dce68
     // Track 34. Reversed 0. Direction 1
-    static constexpr auto moveInfoT34R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT34R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::up25deg },
             { { 8, 1, 0 }, 16, Pitch::up25deg },
@@ -8653,11 +8653,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 29, 14 }, 16, Pitch::up25deg },
             { { 8, 30, 15 }, 16, Pitch::up25deg },
             { { 8, 31, 15 }, 16, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dcf6a
     // Track 34. Reversed 0. Direction 2
-    static constexpr auto moveInfoT34R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT34R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::up25deg },
             { { 1, 24, 0 }, 32, Pitch::up25deg },
@@ -8691,11 +8691,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 24, 14 }, 32, Pitch::up25deg },
             { { 30, 24, 15 }, 32, Pitch::up25deg },
             { { 31, 24, 15 }, 32, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dd06c
     // Track 34. Reversed 0. Direction 3
-    static constexpr auto moveInfoT34R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT34R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::up25deg },
             { { 24, 30, 0 }, 48, Pitch::up25deg },
@@ -8729,11 +8729,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 2, 14 }, 48, Pitch::up25deg },
             { { 24, 1, 15 }, 48, Pitch::up25deg },
             { { 24, 0, 15 }, 48, Pitch::up25deg },
-        });
+        }));
 
     // 0x4ddb82
     // Track 34. Reversed 1. Direction 0
-    static constexpr auto moveInfoT34R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT34R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::down25deg },
             { { 1, 8, 0 }, 32, Pitch::down25deg },
@@ -8767,11 +8767,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 8, -14 }, 32, Pitch::down25deg },
             { { 30, 8, -15 }, 32, Pitch::down25deg },
             { { 31, 8, -15 }, 32, Pitch::down25deg },
-        });
+        }));
 
     // 0x4ddc84
     // Track 34. Reversed 1. Direction 1
-    static constexpr auto moveInfoT34R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT34R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::down25deg },
             { { 8, 30, 0 }, 48, Pitch::down25deg },
@@ -8805,11 +8805,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 2, -14 }, 48, Pitch::down25deg },
             { { 8, 1, -15 }, 48, Pitch::down25deg },
             { { 8, 0, -15 }, 48, Pitch::down25deg },
-        });
+        }));
 
     // 0x4dd97e
     // Track 34. Reversed 1. Direction 2
-    static constexpr auto moveInfoT34R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT34R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::down25deg },
             { { 30, 24, 0 }, 0, Pitch::down25deg },
@@ -8843,11 +8843,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 24, -14 }, 0, Pitch::down25deg },
             { { 1, 24, -15 }, 0, Pitch::down25deg },
             { { 0, 24, -15 }, 0, Pitch::down25deg },
-        });
+        }));
 
     // 0x4dda80
     // Track 34. Reversed 1. Direction 3
-    static constexpr auto moveInfoT34R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT34R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::down25deg },
             { { 24, 1, 0 }, 16, Pitch::down25deg },
@@ -8881,11 +8881,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 29, -14 }, 16, Pitch::down25deg },
             { { 24, 30, -15 }, 16, Pitch::down25deg },
             { { 24, 31, -15 }, 16, Pitch::down25deg },
-        });
+        }));
 
     // 0x4dd576
     // Track 35. Reversed 0. Direction 0
-    static constexpr auto moveInfoT35R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT35R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::up25deg },
             { { 30, 24, 0 }, 0, Pitch::up25deg },
@@ -8919,11 +8919,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 24, 14 }, 0, Pitch::up25deg },
             { { 1, 24, 15 }, 0, Pitch::up25deg },
             { { 0, 24, 15 }, 0, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dd678
     // Track 35. Reversed 0. Direction 1
-    static constexpr auto moveInfoT35R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT35R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::up25deg },
             { { 24, 1, 0 }, 16, Pitch::up25deg },
@@ -8957,11 +8957,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 29, 14 }, 16, Pitch::up25deg },
             { { 24, 30, 15 }, 16, Pitch::up25deg },
             { { 24, 31, 15 }, 16, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dd77a
     // Track 35. Reversed 0. Direction 2
-    static constexpr auto moveInfoT35R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT35R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::up25deg },
             { { 1, 8, 0 }, 32, Pitch::up25deg },
@@ -8995,11 +8995,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 8, 14 }, 32, Pitch::up25deg },
             { { 30, 8, 15 }, 32, Pitch::up25deg },
             { { 31, 8, 15 }, 32, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dd87c
     // Track 35. Reversed 0. Direction 3
-    static constexpr auto moveInfoT35R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT35R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::up25deg },
             { { 8, 30, 0 }, 48, Pitch::up25deg },
@@ -9033,11 +9033,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 2, 14 }, 48, Pitch::up25deg },
             { { 8, 1, 15 }, 48, Pitch::up25deg },
             { { 8, 0, 15 }, 48, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dd372
     // Track 35. Reversed 1. Direction 0
-    static constexpr auto moveInfoT35R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT35R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::down25deg },
             { { 1, 24, 0 }, 32, Pitch::down25deg },
@@ -9071,11 +9071,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 24, -14 }, 32, Pitch::down25deg },
             { { 30, 24, -15 }, 32, Pitch::down25deg },
             { { 31, 24, -15 }, 32, Pitch::down25deg },
-        });
+        }));
 
     // 0x4dd474
     // Track 35. Reversed 1. Direction 1
-    static constexpr auto moveInfoT35R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT35R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::down25deg },
             { { 24, 30, 0 }, 48, Pitch::down25deg },
@@ -9109,11 +9109,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 2, -14 }, 48, Pitch::down25deg },
             { { 24, 1, -15 }, 48, Pitch::down25deg },
             { { 24, 0, -15 }, 48, Pitch::down25deg },
-        });
+        }));
 
     // 0x4dd16e
     // Track 35. Reversed 1. Direction 2
-    static constexpr auto moveInfoT35R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT35R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::down25deg },
             { { 30, 8, 0 }, 0, Pitch::down25deg },
@@ -9147,11 +9147,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 8, -14 }, 0, Pitch::down25deg },
             { { 1, 8, -15 }, 0, Pitch::down25deg },
             { { 0, 8, -15 }, 0, Pitch::down25deg },
-        });
+        }));
 
     // 0x4dd270
     // Track 35. Reversed 1. Direction 3
-    static constexpr auto moveInfoT35R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT35R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::down25deg },
             { { 8, 1, 0 }, 16, Pitch::down25deg },
@@ -9185,11 +9185,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 29, -14 }, 16, Pitch::down25deg },
             { { 8, 30, -15 }, 16, Pitch::down25deg },
             { { 8, 31, -15 }, 16, Pitch::down25deg },
-        });
+        }));
 
     // 0x4ddd86
     // Track 38. Reversed 0. Direction 0
-    static constexpr auto moveInfoT38R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT38R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::flat },
             { { 30, 16, 0 }, 0, Pitch::flat },
@@ -9223,11 +9223,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 8, 0 }, 0, Pitch::flat },
             { { 1, 8, 0 }, 0, Pitch::flat },
             { { 0, 8, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4dde88
     // Track 38. Reversed 0. Direction 1
-    static constexpr auto moveInfoT38R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT38R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::flat },
             { { 16, 1, 0 }, 16, Pitch::flat },
@@ -9261,11 +9261,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 29, 0 }, 16, Pitch::flat },
             { { 8, 30, 0 }, 16, Pitch::flat },
             { { 8, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4ddf8a
     // Track 38. Reversed 0. Direction 2
-    static constexpr auto moveInfoT38R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT38R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::flat },
             { { 1, 16, 0 }, 32, Pitch::flat },
@@ -9299,11 +9299,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 24, 0 }, 32, Pitch::flat },
             { { 30, 24, 0 }, 32, Pitch::flat },
             { { 31, 24, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4de08c
     // Track 38. Reversed 0. Direction 3
-    static constexpr auto moveInfoT38R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT38R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::flat },
             { { 16, 30, 0 }, 48, Pitch::flat },
@@ -9337,11 +9337,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 2, 0 }, 48, Pitch::flat },
             { { 24, 1, 0 }, 48, Pitch::flat },
             { { 24, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4deba2
     // Track 38. Reversed 1. Direction 0
-    static constexpr auto moveInfoT38R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT38R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::flat },
             { { 1, 8, 0 }, 32, Pitch::flat },
@@ -9375,11 +9375,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 16, 0 }, 32, Pitch::flat },
             { { 30, 16, 0 }, 32, Pitch::flat },
             { { 31, 16, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4deca4
     // Track 38. Reversed 1. Direction 1
-    static constexpr auto moveInfoT38R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT38R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::flat },
             { { 8, 30, 0 }, 48, Pitch::flat },
@@ -9413,11 +9413,11 @@ namespace OpenLoco::World::TrackData
             { { 16, 2, 0 }, 48, Pitch::flat },
             { { 16, 1, 0 }, 48, Pitch::flat },
             { { 16, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4de99e
     // Track 38. Reversed 1. Direction 2
-    static constexpr auto moveInfoT38R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT38R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::flat },
             { { 30, 24, 0 }, 0, Pitch::flat },
@@ -9451,11 +9451,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 16, 0 }, 0, Pitch::flat },
             { { 1, 16, 0 }, 0, Pitch::flat },
             { { 0, 16, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4deaa0
     // Track 38. Reversed 1. Direction 3
-    static constexpr auto moveInfoT38R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT38R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::flat },
             { { 24, 1, 0 }, 16, Pitch::flat },
@@ -9489,11 +9489,11 @@ namespace OpenLoco::World::TrackData
             { { 16, 29, 0 }, 16, Pitch::flat },
             { { 16, 30, 0 }, 16, Pitch::flat },
             { { 16, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4de18e
     // Track 39. Reversed 0. Direction 0
-    static constexpr auto moveInfoT39R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT39R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 16, 0 }, 0, Pitch::flat },
             { { 30, 16, 0 }, 0, Pitch::flat },
@@ -9527,11 +9527,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 24, 0 }, 0, Pitch::flat },
             { { 1, 24, 0 }, 0, Pitch::flat },
             { { 0, 24, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4de290
     // Track 39. Reversed 0. Direction 1
-    static constexpr auto moveInfoT39R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT39R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 0, 0 }, 16, Pitch::flat },
             { { 16, 1, 0 }, 16, Pitch::flat },
@@ -9565,11 +9565,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 29, 0 }, 16, Pitch::flat },
             { { 24, 30, 0 }, 16, Pitch::flat },
             { { 24, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4de392
     // Track 39. Reversed 0. Direction 2
-    static constexpr auto moveInfoT39R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT39R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 16, 0 }, 32, Pitch::flat },
             { { 1, 16, 0 }, 32, Pitch::flat },
@@ -9603,11 +9603,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 8, 0 }, 32, Pitch::flat },
             { { 30, 8, 0 }, 32, Pitch::flat },
             { { 31, 8, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4de494
     // Track 39. Reversed 0. Direction 3
-    static constexpr auto moveInfoT39R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT39R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 16, 31, 0 }, 48, Pitch::flat },
             { { 16, 30, 0 }, 48, Pitch::flat },
@@ -9641,11 +9641,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 2, 0 }, 48, Pitch::flat },
             { { 8, 1, 0 }, 48, Pitch::flat },
             { { 8, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4de79a
     // Track 39. Reversed 1. Direction 0
-    static constexpr auto moveInfoT39R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT39R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::flat },
             { { 1, 24, 0 }, 32, Pitch::flat },
@@ -9679,11 +9679,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 16, 0 }, 32, Pitch::flat },
             { { 30, 16, 0 }, 32, Pitch::flat },
             { { 31, 16, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4de89c
     // Track 39. Reversed 1. Direction 1
-    static constexpr auto moveInfoT39R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT39R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::flat },
             { { 24, 30, 0 }, 48, Pitch::flat },
@@ -9717,11 +9717,11 @@ namespace OpenLoco::World::TrackData
             { { 16, 2, 0 }, 48, Pitch::flat },
             { { 16, 1, 0 }, 48, Pitch::flat },
             { { 16, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4de596
     // Track 39. Reversed 1. Direction 2
-    static constexpr auto moveInfoT39R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT39R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::flat },
             { { 30, 8, 0 }, 0, Pitch::flat },
@@ -9755,11 +9755,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 16, 0 }, 0, Pitch::flat },
             { { 1, 16, 0 }, 0, Pitch::flat },
             { { 0, 16, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4de698
     // Track 39. Reversed 1. Direction 3
-    static constexpr auto moveInfoT39R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT39R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::flat },
             { { 8, 1, 0 }, 16, Pitch::flat },
@@ -9793,11 +9793,11 @@ namespace OpenLoco::World::TrackData
             { { 16, 29, 0 }, 16, Pitch::flat },
             { { 16, 30, 0 }, 16, Pitch::flat },
             { { 16, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4deda6
     // Track 42. Reversed 0. Direction 0
-    static constexpr auto moveInfoT42R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT42R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::flat },
             { { 30, 8, 0 }, 0, Pitch::flat },
@@ -9822,11 +9822,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 24, 0 }, 22, Pitch::flat },
             { { 30, 24, 0 }, 32, Pitch::flat },
             { { 31, 24, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4dee60
     // Track 42. Reversed 0. Direction 1
-    static constexpr auto moveInfoT42R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT42R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::flat },
             { { 8, 1, 0 }, 16, Pitch::flat },
@@ -9851,11 +9851,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 2, 0 }, 38, Pitch::flat },
             { { 24, 1, 0 }, 48, Pitch::flat },
             { { 24, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4def1a
     // Track 42. Reversed 0. Direction 2
-    static constexpr auto moveInfoT42R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT42R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::flat },
             { { 1, 24, 0 }, 32, Pitch::flat },
@@ -9880,11 +9880,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 8, 0 }, 54, Pitch::flat },
             { { 1, 8, 0 }, 0, Pitch::flat },
             { { 0, 8, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4defd4
     // Track 42. Reversed 0. Direction 3
-    static constexpr auto moveInfoT42R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT42R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::flat },
             { { 24, 30, 0 }, 48, Pitch::flat },
@@ -9909,11 +9909,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 29, 0 }, 6, Pitch::flat },
             { { 8, 30, 0 }, 16, Pitch::flat },
             { { 8, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4df08e
     // Track 42. Reversed 1. Direction 0
-    static constexpr auto moveInfoT42R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT42R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::flat },
             { { 30, 24, 0 }, 0, Pitch::flat },
@@ -9938,11 +9938,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 8, 0 }, 34, Pitch::flat },
             { { 30, 8, 0 }, 32, Pitch::flat },
             { { 31, 8, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4df148
     // Track 42. Reversed 1. Direction 1
-    static constexpr auto moveInfoT42R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT42R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::flat },
             { { 24, 1, 0 }, 16, Pitch::flat },
@@ -9967,11 +9967,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 2, 0 }, 50, Pitch::flat },
             { { 8, 1, 0 }, 48, Pitch::flat },
             { { 8, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4df202
     // Track 42. Reversed 1. Direction 2
-    static constexpr auto moveInfoT42R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT42R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::flat },
             { { 1, 8, 0 }, 32, Pitch::flat },
@@ -9996,11 +9996,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 24, 0 }, 2, Pitch::flat },
             { { 1, 24, 0 }, 0, Pitch::flat },
             { { 0, 24, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4df2bc
     // Track 42. Reversed 1. Direction 3
-    static constexpr auto moveInfoT42R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoT42R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::flat },
             { { 8, 30, 0 }, 48, Pitch::flat },
@@ -10025,13 +10025,13 @@ namespace OpenLoco::World::TrackData
             { { 24, 29, 0 }, 18, Pitch::flat },
             { { 24, 30, 0 }, 16, Pitch::flat },
             { { 24, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 #pragma endregion
 
 #pragma region RoadData
     // 0x4dc556
     // Turnaround 0. Lane 0. Track 0. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L0T0R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T0R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::flat },
             { { 30, 8, 0 }, 0, Pitch::flat },
@@ -10065,11 +10065,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 8, 0 }, 0, Pitch::flat },
             { { 1, 8, 0 }, 0, Pitch::flat },
             { { 0, 8, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4dc658
     // Turnaround 0. Lane 0. Track 0. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L0T0R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T0R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::flat },
             { { 8, 1, 0 }, 16, Pitch::flat },
@@ -10103,11 +10103,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 29, 0 }, 16, Pitch::flat },
             { { 8, 30, 0 }, 16, Pitch::flat },
             { { 8, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4dc75a
     // Turnaround 0. Lane 0. Track 0. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L0T0R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T0R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::flat },
             { { 1, 24, 0 }, 32, Pitch::flat },
@@ -10141,11 +10141,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 24, 0 }, 32, Pitch::flat },
             { { 30, 24, 0 }, 32, Pitch::flat },
             { { 31, 24, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4dc85c
     // Turnaround 0. Lane 0. Track 0. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L0T0R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T0R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::flat },
             { { 24, 30, 0 }, 48, Pitch::flat },
@@ -10179,11 +10179,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 2, 0 }, 48, Pitch::flat },
             { { 24, 1, 0 }, 48, Pitch::flat },
             { { 24, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4eaafe
     // Turnaround 0. Lane 0. Track 1. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L0T1R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T1R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::flat },
             { { 30, 8, 0 }, 0, Pitch::flat },
@@ -10197,11 +10197,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 2, 0 }, 48, Pitch::flat },
             { { 24, 1, 0 }, 48, Pitch::flat },
             { { 24, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4eab60
     // Turnaround 0. Lane 0. Track 1. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L0T1R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T1R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::flat },
             { { 8, 1, 0 }, 16, Pitch::flat },
@@ -10215,11 +10215,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 8, 0 }, 2, Pitch::flat },
             { { 1, 8, 0 }, 0, Pitch::flat },
             { { 0, 8, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4eabc2
     // Turnaround 0. Lane 0. Track 1. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L0T1R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T1R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::flat },
             { { 1, 24, 0 }, 32, Pitch::flat },
@@ -10233,11 +10233,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 29, 0 }, 18, Pitch::flat },
             { { 8, 30, 0 }, 16, Pitch::flat },
             { { 8, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4eac24
     // Turnaround 0. Lane 0. Track 1. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L0T1R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T1R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::flat },
             { { 24, 30, 0 }, 48, Pitch::flat },
@@ -10250,11 +10250,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 24, 0 }, 34, Pitch::flat },
             { { 30, 24, 0 }, 32, Pitch::flat },
             { { 31, 24, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4ead88
     // Turnaround 0. Lane 0. Track 1. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA0L0T1R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T1R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::flat },
             { { 8, 1, 0 }, 16, Pitch::flat },
@@ -10290,11 +10290,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 24, 0 }, 32, Pitch::flat },
             { { 30, 24, 0 }, 32, Pitch::flat },
             { { 31, 24, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4eae9a
     // Turnaround 0. Lane 0. Track 1. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA0L0T1R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T1R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::flat },
             { { 1, 24, 0 }, 32, Pitch::flat },
@@ -10331,11 +10331,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 2, 0 }, 48, Pitch::flat },
             { { 24, 1, 0 }, 48, Pitch::flat },
             { { 24, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4eafb4
     // Turnaround 0. Lane 0. Track 1. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA0L0T1R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T1R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::flat },
             { { 24, 30, 0 }, 48, Pitch::flat },
@@ -10371,11 +10371,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 8, 0 }, 0, Pitch::flat },
             { { 1, 8, 0 }, 0, Pitch::flat },
             { { 0, 8, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4eac7e
     // Turnaround 0. Lane 0. Track 1. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA0L0T1R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T1R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::flat },
             { { 30, 8, 0 }, 0, Pitch::flat },
@@ -10410,11 +10410,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 29, 0 }, 16, Pitch::flat },
             { { 8, 30, 0 }, 16, Pitch::flat },
             { { 8, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4edebe
     // Turnaround 0. Lane 0. Track 3. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L0T3R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T3R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::flat },
             { { 30, 8, 0 }, 0, Pitch::flat },
@@ -10474,11 +10474,11 @@ namespace OpenLoco::World::TrackData
             { { -8, -30, 0 }, 48, Pitch::flat },
             { { -8, -31, 0 }, 48, Pitch::flat },
             { { -8, -32, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4ee090
     // Turnaround 0. Lane 0. Track 3. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L0T3R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T3R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::flat },
             { { 8, 1, 0 }, 16, Pitch::flat },
@@ -10539,11 +10539,11 @@ namespace OpenLoco::World::TrackData
             { { -30, 40, 0 }, 0, Pitch::flat },
             { { -31, 40, 0 }, 0, Pitch::flat },
             { { -32, 40, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4ee26a
     // Turnaround 0. Lane 0. Track 3. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L0T3R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T3R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::flat },
             { { 1, 24, 0 }, 32, Pitch::flat },
@@ -10603,11 +10603,11 @@ namespace OpenLoco::World::TrackData
             { { 40, 61, 0 }, 16, Pitch::flat },
             { { 40, 62, 0 }, 16, Pitch::flat },
             { { 40, 63, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4ee43c
     // Turnaround 0. Lane 0. Track 3. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L0T3R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T3R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::flat },
             { { 24, 30, 0 }, 48, Pitch::flat },
@@ -10666,11 +10666,11 @@ namespace OpenLoco::World::TrackData
             { { 61, -8, 0 }, 32, Pitch::flat },
             { { 62, -8, 0 }, 32, Pitch::flat },
             { { 63, -8, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4ee880
     // Turnaround 0. Lane 0. Track 3. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA0L0T3R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T3R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::flat },
             { { 8, 1, 0 }, 16, Pitch::flat },
@@ -10752,11 +10752,11 @@ namespace OpenLoco::World::TrackData
             { { 61, 56, 0 }, 32, Pitch::flat },
             { { 62, 56, 0 }, 32, Pitch::flat },
             { { 63, 56, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4eeb02
     // Turnaround 0. Lane 0. Track 3. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA0L0T3R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T3R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::flat },
             { { 1, 24, 0 }, 32, Pitch::flat },
@@ -10839,11 +10839,11 @@ namespace OpenLoco::World::TrackData
             { { 56, -30, 0 }, 48, Pitch::flat },
             { { 56, -31, 0 }, 48, Pitch::flat },
             { { 56, -32, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4eed8c
     // Turnaround 0. Lane 0. Track 3. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA0L0T3R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T3R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::flat },
             { { 24, 30, 0 }, 48, Pitch::flat },
@@ -10925,11 +10925,11 @@ namespace OpenLoco::World::TrackData
             { { -30, -24, 0 }, 0, Pitch::flat },
             { { -31, -24, 0 }, 0, Pitch::flat },
             { { -32, -24, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4ee606
     // Turnaround 0. Lane 0. Track 3. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA0L0T3R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T3R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::flat },
             { { 30, 8, 0 }, 0, Pitch::flat },
@@ -11010,11 +11010,11 @@ namespace OpenLoco::World::TrackData
             { { -24, 61, 0 }, 16, Pitch::flat },
             { { -24, 62, 0 }, 16, Pitch::flat },
             { { -24, 63, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4ebe9e
     // Turnaround 0. Lane 0. Track 5. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L0T5R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T5R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::up12deg },
             { { 30, 8, 0 }, 0, Pitch::up12deg },
@@ -11080,11 +11080,11 @@ namespace OpenLoco::World::TrackData
             { { -30, 8, 15 }, 0, Pitch::up12deg },
             { { -31, 8, 15 }, 0, Pitch::up12deg },
             { { -32, 8, 15 }, 0, Pitch::up12deg },
-        });
+        }));
 
     // 0x4ec0a0
     // Turnaround 0. Lane 0. Track 5. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L0T5R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T5R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::up12deg },
             { { 8, 1, 0 }, 16, Pitch::up12deg },
@@ -11150,11 +11150,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 61, 15 }, 16, Pitch::up12deg },
             { { 8, 62, 15 }, 16, Pitch::up12deg },
             { { 8, 63, 15 }, 16, Pitch::up12deg },
-        });
+        }));
 
     // 0x4ec2a2
     // Turnaround 0. Lane 0. Track 5. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L0T5R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T5R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::up12deg },
             { { 1, 24, 0 }, 32, Pitch::up12deg },
@@ -11220,11 +11220,11 @@ namespace OpenLoco::World::TrackData
             { { 61, 24, 15 }, 32, Pitch::up12deg },
             { { 62, 24, 15 }, 32, Pitch::up12deg },
             { { 63, 24, 15 }, 32, Pitch::up12deg },
-        });
+        }));
 
     // 0x4ec4a4
     // Turnaround 0. Lane 0. Track 5. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L0T5R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T5R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::up12deg },
             { { 24, 30, 0 }, 48, Pitch::up12deg },
@@ -11290,11 +11290,11 @@ namespace OpenLoco::World::TrackData
             { { 24, -30, 15 }, 48, Pitch::up12deg },
             { { 24, -31, 15 }, 48, Pitch::up12deg },
             { { 24, -32, 15 }, 48, Pitch::up12deg },
-        });
+        }));
 
     // 0x4ecaaa
     // Turnaround 0. Lane 0. Track 5. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA0L0T5R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T5R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::down12deg },
             { { 1, 24, 0 }, 32, Pitch::down12deg },
@@ -11360,11 +11360,11 @@ namespace OpenLoco::World::TrackData
             { { 61, 24, -15 }, 32, Pitch::down12deg },
             { { 62, 24, -15 }, 32, Pitch::down12deg },
             { { 63, 24, -15 }, 32, Pitch::down12deg },
-        });
+        }));
 
     // 0x4eccac
     // Turnaround 0. Lane 0. Track 5. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA0L0T5R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T5R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::down12deg },
             { { 24, 30, 0 }, 48, Pitch::down12deg },
@@ -11430,11 +11430,11 @@ namespace OpenLoco::World::TrackData
             { { 24, -30, -15 }, 48, Pitch::down12deg },
             { { 24, -31, -15 }, 48, Pitch::down12deg },
             { { 24, -32, -15 }, 48, Pitch::down12deg },
-        });
+        }));
 
     // 0x4ec6a6
     // Turnaround 0. Lane 0. Track 5. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA0L0T5R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T5R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::down12deg },
             { { 30, 8, 0 }, 0, Pitch::down12deg },
@@ -11500,11 +11500,11 @@ namespace OpenLoco::World::TrackData
             { { -30, 8, -15 }, 0, Pitch::down12deg },
             { { -31, 8, -15 }, 0, Pitch::down12deg },
             { { -32, 8, -15 }, 0, Pitch::down12deg },
-        });
+        }));
 
     // 0x4ec8a8
     // Turnaround 0. Lane 0. Track 5. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA0L0T5R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T5R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::down12deg },
             { { 8, 1, 0 }, 16, Pitch::down12deg },
@@ -11570,11 +11570,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 61, -15 }, 16, Pitch::down12deg },
             { { 8, 62, -15 }, 16, Pitch::down12deg },
             { { 8, 63, -15 }, 16, Pitch::down12deg },
-        });
+        }));
 
     // 0x4dcd66
     // Turnaround 0. Lane 0. Track 7. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L0T7R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T7R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::up25deg },
             { { 30, 8, 0 }, 0, Pitch::up25deg },
@@ -11608,11 +11608,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 8, 14 }, 0, Pitch::up25deg },
             { { 1, 8, 15 }, 0, Pitch::up25deg },
             { { 0, 8, 15 }, 0, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dce68
     // Turnaround 0. Lane 0. Track 7. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L0T7R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T7R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::up25deg },
             { { 8, 1, 0 }, 16, Pitch::up25deg },
@@ -11646,11 +11646,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 29, 14 }, 16, Pitch::up25deg },
             { { 8, 30, 15 }, 16, Pitch::up25deg },
             { { 8, 31, 15 }, 16, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dcf6a
     // Turnaround 0. Lane 0. Track 7. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L0T7R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T7R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::up25deg },
             { { 1, 24, 0 }, 32, Pitch::up25deg },
@@ -11684,11 +11684,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 24, 14 }, 32, Pitch::up25deg },
             { { 30, 24, 15 }, 32, Pitch::up25deg },
             { { 31, 24, 15 }, 32, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dd06c
     // Turnaround 0. Lane 0. Track 7. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L0T7R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T7R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::up25deg },
             { { 24, 30, 0 }, 48, Pitch::up25deg },
@@ -11722,11 +11722,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 2, 14 }, 48, Pitch::up25deg },
             { { 24, 1, 15 }, 48, Pitch::up25deg },
             { { 24, 0, 15 }, 48, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dd372
     // Turnaround 0. Lane 0. Track 7. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA0L0T7R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T7R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::down25deg },
             { { 1, 24, 0 }, 32, Pitch::down25deg },
@@ -11760,11 +11760,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 24, -14 }, 32, Pitch::down25deg },
             { { 30, 24, -15 }, 32, Pitch::down25deg },
             { { 31, 24, -15 }, 32, Pitch::down25deg },
-        });
+        }));
 
     // 0x4dd474
     // Turnaround 0. Lane 0. Track 7. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA0L0T7R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T7R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::down25deg },
             { { 24, 30, 0 }, 48, Pitch::down25deg },
@@ -11798,11 +11798,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 2, -14 }, 48, Pitch::down25deg },
             { { 24, 1, -15 }, 48, Pitch::down25deg },
             { { 24, 0, -15 }, 48, Pitch::down25deg },
-        });
+        }));
 
     // 0x4dd16e
     // Turnaround 0. Lane 0. Track 7. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA0L0T7R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T7R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::down25deg },
             { { 30, 8, 0 }, 0, Pitch::down25deg },
@@ -11836,11 +11836,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 8, -14 }, 0, Pitch::down25deg },
             { { 1, 8, -15 }, 0, Pitch::down25deg },
             { { 0, 8, -15 }, 0, Pitch::down25deg },
-        });
+        }));
 
     // 0x4dd270
     // Turnaround 0. Lane 0. Track 7. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA0L0T7R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T7R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::down25deg },
             { { 8, 1, 0 }, 16, Pitch::down25deg },
@@ -11874,11 +11874,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 29, -14 }, 16, Pitch::down25deg },
             { { 8, 30, -15 }, 16, Pitch::down25deg },
             { { 8, 31, -15 }, 16, Pitch::down25deg },
-        });
+        }));
 
     // 0x4deda6
     // Turnaround 0. Lane 0. Track 9. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L0T9R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T9R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::flat },
             { { 30, 8, 0 }, 0, Pitch::flat },
@@ -11903,11 +11903,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 24, 0 }, 22, Pitch::flat },
             { { 30, 24, 0 }, 32, Pitch::flat },
             { { 31, 24, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4dee60
     // Turnaround 0. Lane 0. Track 9. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L0T9R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T9R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::flat },
             { { 8, 1, 0 }, 16, Pitch::flat },
@@ -11932,11 +11932,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 2, 0 }, 38, Pitch::flat },
             { { 24, 1, 0 }, 48, Pitch::flat },
             { { 24, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4def1a
     // Turnaround 0. Lane 0. Track 9. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L0T9R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T9R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::flat },
             { { 1, 24, 0 }, 32, Pitch::flat },
@@ -11961,11 +11961,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 8, 0 }, 54, Pitch::flat },
             { { 1, 8, 0 }, 0, Pitch::flat },
             { { 0, 8, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4defd4
     // Turnaround 0. Lane 0. Track 9. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L0T9R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L0T9R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::flat },
             { { 24, 30, 0 }, 48, Pitch::flat },
@@ -11990,11 +11990,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 29, 0 }, 6, Pitch::flat },
             { { 8, 30, 0 }, 16, Pitch::flat },
             { { 8, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4dc95e
     // Turnaround 0. Lane 1. Track 0. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L1T0R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T0R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::flat },
             { { 30, 24, 0 }, 0, Pitch::flat },
@@ -12028,11 +12028,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 24, 0 }, 0, Pitch::flat },
             { { 1, 24, 0 }, 0, Pitch::flat },
             { { 0, 24, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4dca60
     // Turnaround 0. Lane 1. Track 0. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L1T0R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T0R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::flat },
             { { 24, 1, 0 }, 16, Pitch::flat },
@@ -12066,11 +12066,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 29, 0 }, 16, Pitch::flat },
             { { 24, 30, 0 }, 16, Pitch::flat },
             { { 24, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4dcb62
     // Turnaround 0. Lane 1. Track 0. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L1T0R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T0R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::flat },
             { { 1, 8, 0 }, 32, Pitch::flat },
@@ -12104,11 +12104,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 8, 0 }, 32, Pitch::flat },
             { { 30, 8, 0 }, 32, Pitch::flat },
             { { 31, 8, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4dcc64
     // Turnaround 0. Lane 1. Track 0. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L1T0R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T0R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::flat },
             { { 8, 30, 0 }, 48, Pitch::flat },
@@ -12142,11 +12142,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 2, 0 }, 48, Pitch::flat },
             { { 8, 1, 0 }, 48, Pitch::flat },
             { { 8, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4eb350
     // Turnaround 0. Lane 1. Track 1. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L1T1R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T1R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::flat },
             { { 30, 24, 0 }, 0, Pitch::flat },
@@ -12182,11 +12182,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 2, 0 }, 48, Pitch::flat },
             { { 8, 1, 0 }, 48, Pitch::flat },
             { { 8, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4eb462
     // Turnaround 0. Lane 1. Track 1. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L1T1R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T1R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::flat },
             { { 24, 1, 0 }, 16, Pitch::flat },
@@ -12223,11 +12223,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 24, 0 }, 0, Pitch::flat },
             { { 1, 24, 0 }, 0, Pitch::flat },
             { { 0, 24, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4eb57c
     // Turnaround 0. Lane 1. Track 1. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L1T1R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T1R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::flat },
             { { 1, 8, 0 }, 32, Pitch::flat },
@@ -12263,11 +12263,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 29, 0 }, 16, Pitch::flat },
             { { 24, 30, 0 }, 16, Pitch::flat },
             { { 24, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4eb246
     // Turnaround 0. Lane 1. Track 1. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L1T1R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T1R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::flat },
             { { 8, 30, 0 }, 48, Pitch::flat },
@@ -12302,11 +12302,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 8, 0 }, 32, Pitch::flat },
             { { 30, 8, 0 }, 32, Pitch::flat },
             { { 31, 8, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4eb0c6
     // Turnaround 0. Lane 1. Track 1. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA0L1T1R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T1R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::flat },
             { { 24, 1, 0 }, 16, Pitch::flat },
@@ -12320,11 +12320,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 8, 0 }, 30, Pitch::flat },
             { { 30, 8, 0 }, 32, Pitch::flat },
             { { 31, 8, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4eb128
     // Turnaround 0. Lane 1. Track 1. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA0L1T1R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T1R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::flat },
             { { 1, 8, 0 }, 32, Pitch::flat },
@@ -12338,11 +12338,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 2, 0 }, 46, Pitch::flat },
             { { 8, 1, 0 }, 48, Pitch::flat },
             { { 8, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4eb18a
     // Turnaround 0. Lane 1. Track 1. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA0L1T1R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T1R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::flat },
             { { 8, 30, 0 }, 48, Pitch::flat },
@@ -12356,11 +12356,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 24, 0 }, 0, Pitch::flat },
             { { 1, 24, 0 }, 0, Pitch::flat },
             { { 0, 24, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4eb1ec
     // Turnaround 0. Lane 1. Track 1. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA0L1T1R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T1R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::flat },
             { { 30, 24, 0 }, 0, Pitch::flat },
@@ -12373,11 +12373,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 29, 0 }, 14, Pitch::flat },
             { { 24, 30, 0 }, 16, Pitch::flat },
             { { 24, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4ef756
     // Turnaround 0. Lane 1. Track 3. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L1T3R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T3R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::flat },
             { { 30, 24, 0 }, 0, Pitch::flat },
@@ -12459,11 +12459,11 @@ namespace OpenLoco::World::TrackData
             { { -24, -30, 0 }, 48, Pitch::flat },
             { { -24, -31, 0 }, 48, Pitch::flat },
             { { -24, -32, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4ef9d8
     // Turnaround 0. Lane 1. Track 3. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L1T3R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T3R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::flat },
             { { 24, 1, 0 }, 16, Pitch::flat },
@@ -12546,11 +12546,11 @@ namespace OpenLoco::World::TrackData
             { { -30, 56, 0 }, 0, Pitch::flat },
             { { -31, 56, 0 }, 0, Pitch::flat },
             { { -32, 56, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4efc62
     // Turnaround 0. Lane 1. Track 3. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L1T3R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T3R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::flat },
             { { 1, 8, 0 }, 32, Pitch::flat },
@@ -12632,11 +12632,11 @@ namespace OpenLoco::World::TrackData
             { { 56, 61, 0 }, 16, Pitch::flat },
             { { 56, 62, 0 }, 16, Pitch::flat },
             { { 56, 63, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4efee4
     // Turnaround 0. Lane 1. Track 3. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L1T3R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T3R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::flat },
             { { 8, 30, 0 }, 48, Pitch::flat },
@@ -12717,11 +12717,11 @@ namespace OpenLoco::World::TrackData
             { { 61, -24, 0 }, 32, Pitch::flat },
             { { 62, -24, 0 }, 32, Pitch::flat },
             { { 63, -24, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4ef1d8
     // Turnaround 0. Lane 1. Track 3. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA0L1T3R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T3R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::flat },
             { { 24, 1, 0 }, 16, Pitch::flat },
@@ -12781,11 +12781,11 @@ namespace OpenLoco::World::TrackData
             { { 61, 40, 0 }, 32, Pitch::flat },
             { { 62, 40, 0 }, 32, Pitch::flat },
             { { 63, 40, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4ef3aa
     // Turnaround 0. Lane 1. Track 3. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA0L1T3R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T3R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::flat },
             { { 1, 8, 0 }, 32, Pitch::flat },
@@ -12846,11 +12846,11 @@ namespace OpenLoco::World::TrackData
             { { 40, -30, 0 }, 48, Pitch::flat },
             { { 40, -31, 0 }, 48, Pitch::flat },
             { { 40, -32, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4ef584
     // Turnaround 0. Lane 1. Track 3. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA0L1T3R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T3R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::flat },
             { { 8, 30, 0 }, 48, Pitch::flat },
@@ -12910,11 +12910,11 @@ namespace OpenLoco::World::TrackData
             { { -30, -8, 0 }, 0, Pitch::flat },
             { { -31, -8, 0 }, 0, Pitch::flat },
             { { -32, -8, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4ef00e
     // Turnaround 0. Lane 1. Track 3. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA0L1T3R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T3R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::flat },
             { { 30, 24, 0 }, 0, Pitch::flat },
@@ -12973,11 +12973,11 @@ namespace OpenLoco::World::TrackData
             { { -8, 61, 0 }, 16, Pitch::flat },
             { { -8, 62, 0 }, 16, Pitch::flat },
             { { -8, 63, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4eceae
     // Turnaround 0. Lane 1. Track 5. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L1T5R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T5R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::up12deg },
             { { 30, 24, 0 }, 0, Pitch::up12deg },
@@ -13043,11 +13043,11 @@ namespace OpenLoco::World::TrackData
             { { -30, 24, 15 }, 0, Pitch::up12deg },
             { { -31, 24, 15 }, 0, Pitch::up12deg },
             { { -32, 24, 15 }, 0, Pitch::up12deg },
-        });
+        }));
 
     // 0x4ed0b0
     // Turnaround 0. Lane 1. Track 5. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L1T5R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T5R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::up12deg },
             { { 24, 1, 0 }, 16, Pitch::up12deg },
@@ -13113,11 +13113,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 61, 15 }, 16, Pitch::up12deg },
             { { 24, 62, 15 }, 16, Pitch::up12deg },
             { { 24, 63, 15 }, 16, Pitch::up12deg },
-        });
+        }));
 
     // 0x4ed2b2
     // Turnaround 0. Lane 1. Track 5. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L1T5R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T5R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::up12deg },
             { { 1, 8, 0 }, 32, Pitch::up12deg },
@@ -13183,11 +13183,11 @@ namespace OpenLoco::World::TrackData
             { { 61, 8, 15 }, 32, Pitch::up12deg },
             { { 62, 8, 15 }, 32, Pitch::up12deg },
             { { 63, 8, 15 }, 32, Pitch::up12deg },
-        });
+        }));
 
     // 0x4ed4b4
     // Turnaround 0. Lane 1. Track 5. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L1T5R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T5R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::up12deg },
             { { 8, 30, 0 }, 48, Pitch::up12deg },
@@ -13253,11 +13253,11 @@ namespace OpenLoco::World::TrackData
             { { 8, -30, 15 }, 48, Pitch::up12deg },
             { { 8, -31, 15 }, 48, Pitch::up12deg },
             { { 8, -32, 15 }, 48, Pitch::up12deg },
-        });
+        }));
 
     // 0x4edaba
     // Turnaround 0. Lane 1. Track 5. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA0L1T5R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T5R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::down12deg },
             { { 1, 8, 0 }, 32, Pitch::down12deg },
@@ -13323,11 +13323,11 @@ namespace OpenLoco::World::TrackData
             { { 61, 8, -15 }, 32, Pitch::down12deg },
             { { 62, 8, -15 }, 32, Pitch::down12deg },
             { { 63, 8, -15 }, 32, Pitch::down12deg },
-        });
+        }));
 
     // 0x4edcbc
     // Turnaround 0. Lane 1. Track 5. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA0L1T5R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T5R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::down12deg },
             { { 8, 30, 0 }, 48, Pitch::down12deg },
@@ -13393,11 +13393,11 @@ namespace OpenLoco::World::TrackData
             { { 8, -30, -15 }, 48, Pitch::down12deg },
             { { 8, -31, -15 }, 48, Pitch::down12deg },
             { { 8, -32, -15 }, 48, Pitch::down12deg },
-        });
+        }));
 
     // 0x4ed6b6
     // Turnaround 0. Lane 1. Track 5. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA0L1T5R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T5R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::down12deg },
             { { 30, 24, 0 }, 0, Pitch::down12deg },
@@ -13463,11 +13463,11 @@ namespace OpenLoco::World::TrackData
             { { -30, 24, -15 }, 0, Pitch::down12deg },
             { { -31, 24, -15 }, 0, Pitch::down12deg },
             { { -32, 24, -15 }, 0, Pitch::down12deg },
-        });
+        }));
 
     // 0x4ed8b8
     // Turnaround 0. Lane 1. Track 5. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA0L1T5R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T5R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::down12deg },
             { { 24, 1, 0 }, 16, Pitch::down12deg },
@@ -13533,11 +13533,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 61, -15 }, 16, Pitch::down12deg },
             { { 24, 62, -15 }, 16, Pitch::down12deg },
             { { 24, 63, -15 }, 16, Pitch::down12deg },
-        });
+        }));
 
     // 0x4dd576
     // Turnaround 0. Lane 1. Track 7. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L1T7R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T7R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::up25deg },
             { { 30, 24, 0 }, 0, Pitch::up25deg },
@@ -13571,11 +13571,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 24, 14 }, 0, Pitch::up25deg },
             { { 1, 24, 15 }, 0, Pitch::up25deg },
             { { 0, 24, 15 }, 0, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dd678
     // Turnaround 0. Lane 1. Track 7. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L1T7R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T7R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::up25deg },
             { { 24, 1, 0 }, 16, Pitch::up25deg },
@@ -13609,11 +13609,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 29, 14 }, 16, Pitch::up25deg },
             { { 24, 30, 15 }, 16, Pitch::up25deg },
             { { 24, 31, 15 }, 16, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dd77a
     // Turnaround 0. Lane 1. Track 7. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L1T7R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T7R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::up25deg },
             { { 1, 8, 0 }, 32, Pitch::up25deg },
@@ -13647,11 +13647,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 8, 14 }, 32, Pitch::up25deg },
             { { 30, 8, 15 }, 32, Pitch::up25deg },
             { { 31, 8, 15 }, 32, Pitch::up25deg },
-        });
+        }));
 
     // 0x4dd87c
     // Turnaround 0. Lane 1. Track 7. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L1T7R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T7R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::up25deg },
             { { 8, 30, 0 }, 48, Pitch::up25deg },
@@ -13685,11 +13685,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 2, 14 }, 48, Pitch::up25deg },
             { { 8, 1, 15 }, 48, Pitch::up25deg },
             { { 8, 0, 15 }, 48, Pitch::up25deg },
-        });
+        }));
 
     // 0x4ddb82
     // Turnaround 0. Lane 1. Track 7. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA0L1T7R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T7R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::down25deg },
             { { 1, 8, 0 }, 32, Pitch::down25deg },
@@ -13723,11 +13723,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 8, -14 }, 32, Pitch::down25deg },
             { { 30, 8, -15 }, 32, Pitch::down25deg },
             { { 31, 8, -15 }, 32, Pitch::down25deg },
-        });
+        }));
 
     // 0x4ddc84
     // Turnaround 0. Lane 1. Track 7. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA0L1T7R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T7R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::down25deg },
             { { 8, 30, 0 }, 48, Pitch::down25deg },
@@ -13761,11 +13761,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 2, -14 }, 48, Pitch::down25deg },
             { { 8, 1, -15 }, 48, Pitch::down25deg },
             { { 8, 0, -15 }, 48, Pitch::down25deg },
-        });
+        }));
 
     // 0x4dd97e
     // Turnaround 0. Lane 1. Track 7. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA0L1T7R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T7R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::down25deg },
             { { 30, 24, 0 }, 0, Pitch::down25deg },
@@ -13799,11 +13799,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 24, -14 }, 0, Pitch::down25deg },
             { { 1, 24, -15 }, 0, Pitch::down25deg },
             { { 0, 24, -15 }, 0, Pitch::down25deg },
-        });
+        }));
 
     // 0x4dda80
     // Turnaround 0. Lane 1. Track 7. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA0L1T7R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T7R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::down25deg },
             { { 24, 1, 0 }, 16, Pitch::down25deg },
@@ -13837,11 +13837,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 29, -14 }, 16, Pitch::down25deg },
             { { 24, 30, -15 }, 16, Pitch::down25deg },
             { { 24, 31, -15 }, 16, Pitch::down25deg },
-        });
+        }));
 
     // 0x4df08e
     // Turnaround 0. Lane 1. Track 9. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L1T9R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T9R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::flat },
             { { 30, 24, 0 }, 0, Pitch::flat },
@@ -13866,11 +13866,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 8, 0 }, 34, Pitch::flat },
             { { 30, 8, 0 }, 32, Pitch::flat },
             { { 31, 8, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4df148
     // Turnaround 0. Lane 1. Track 9. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L1T9R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T9R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::flat },
             { { 24, 1, 0 }, 16, Pitch::flat },
@@ -13895,11 +13895,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 2, 0 }, 50, Pitch::flat },
             { { 8, 1, 0 }, 48, Pitch::flat },
             { { 8, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4df202
     // Turnaround 0. Lane 1. Track 9. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L1T9R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T9R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::flat },
             { { 1, 8, 0 }, 32, Pitch::flat },
@@ -13924,11 +13924,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 24, 0 }, 2, Pitch::flat },
             { { 1, 24, 0 }, 0, Pitch::flat },
             { { 0, 24, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4df2bc
     // Turnaround 0. Lane 1. Track 9. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L1T9R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA0L1T9R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::flat },
             { { 8, 30, 0 }, 48, Pitch::flat },
@@ -13953,11 +13953,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 29, 0 }, 18, Pitch::flat },
             { { 24, 30, 0 }, 16, Pitch::flat },
             { { 24, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4f217e
     // Turnaround 1. Lane 0. Track 0. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L0T0R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T0R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::flat },
             { { 30, 8, 0 }, 0, Pitch::flat },
@@ -13991,11 +13991,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 22, 0 }, 0, Pitch::flat },
             { { 1, 23, 0 }, 0, Pitch::flat },
             { { 0, 23, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4f2280
     // Turnaround 1. Lane 0. Track 0. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L0T0R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T0R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::flat },
             { { 8, 1, 0 }, 16, Pitch::flat },
@@ -14029,11 +14029,11 @@ namespace OpenLoco::World::TrackData
             { { 22, 29, 0 }, 16, Pitch::flat },
             { { 23, 30, 0 }, 16, Pitch::flat },
             { { 23, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4f2382
     // Turnaround 1. Lane 0. Track 0. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L0T0R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T0R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::flat },
             { { 1, 24, 0 }, 32, Pitch::flat },
@@ -14067,11 +14067,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 10, 0 }, 32, Pitch::flat },
             { { 30, 9, 0 }, 32, Pitch::flat },
             { { 31, 9, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4f2484
     // Turnaround 1. Lane 0. Track 0. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L0T0R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T0R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::flat },
             { { 24, 30, 0 }, 48, Pitch::flat },
@@ -14105,11 +14105,11 @@ namespace OpenLoco::World::TrackData
             { { 10, 2, 0 }, 48, Pitch::flat },
             { { 9, 1, 0 }, 48, Pitch::flat },
             { { 9, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4f39ae
     // Turnaround 1. Lane 0. Track 1. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L0T1R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T1R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::flat },
             { { 30, 8, 0 }, 0, Pitch::flat },
@@ -14139,11 +14139,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 2, 0 }, 48, Pitch::flat },
             { { 8, 1, 0 }, 48, Pitch::flat },
             { { 8, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4f3a90
     // Turnaround 1. Lane 0. Track 1. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L0T1R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T1R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::flat },
             { { 8, 1, 0 }, 16, Pitch::flat },
@@ -14173,11 +14173,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 24, 0 }, 2, Pitch::flat },
             { { 1, 24, 0 }, 0, Pitch::flat },
             { { 0, 24, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4f3b72
     // Turnaround 1. Lane 0. Track 1. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L0T1R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T1R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::flat },
             { { 1, 24, 0 }, 32, Pitch::flat },
@@ -14207,11 +14207,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 29, 0 }, 18, Pitch::flat },
             { { 24, 30, 0 }, 16, Pitch::flat },
             { { 24, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4f3c54
     // Turnaround 1. Lane 0. Track 1. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L0T1R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T1R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::flat },
             { { 24, 30, 0 }, 48, Pitch::flat },
@@ -14240,11 +14240,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 8, 0 }, 34, Pitch::flat },
             { { 30, 8, 0 }, 32, Pitch::flat },
             { { 31, 8, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4f3e08
     // Turnaround 1. Lane 0. Track 1. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA1L0T1R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T1R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::flat },
             { { 8, 1, 0 }, 16, Pitch::flat },
@@ -14274,11 +14274,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 8, 0 }, 32, Pitch::flat },
             { { 30, 8, 0 }, 32, Pitch::flat },
             { { 31, 8, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4f3eea
     // Turnaround 1. Lane 0. Track 1. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA1L0T1R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T1R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::flat },
             { { 1, 24, 0 }, 32, Pitch::flat },
@@ -14308,11 +14308,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 2, 0 }, 48, Pitch::flat },
             { { 8, 1, 0 }, 48, Pitch::flat },
             { { 8, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4f3fcc
     // Turnaround 1. Lane 0. Track 1. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA1L0T1R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T1R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::flat },
             { { 24, 30, 0 }, 48, Pitch::flat },
@@ -14342,11 +14342,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 24, 0 }, 0, Pitch::flat },
             { { 1, 24, 0 }, 0, Pitch::flat },
             { { 0, 24, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4f3d2e
     // Turnaround 1. Lane 0. Track 1. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA1L0T1R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T1R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::flat },
             { { 30, 8, 0 }, 0, Pitch::flat },
@@ -14375,11 +14375,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 29, 0 }, 16, Pitch::flat },
             { { 24, 30, 0 }, 16, Pitch::flat },
             { { 24, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4f47ae
     // Turnaround 1. Lane 0. Track 3. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L0T3R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T3R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::flat },
             { { 30, 8, 0 }, 0, Pitch::flat },
@@ -14455,11 +14455,11 @@ namespace OpenLoco::World::TrackData
             { { -24, -30, 0 }, 48, Pitch::flat },
             { { -24, -31, 0 }, 48, Pitch::flat },
             { { -24, -32, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4f4a00
     // Turnaround 1. Lane 0. Track 3. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L0T3R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T3R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::flat },
             { { 8, 1, 0 }, 16, Pitch::flat },
@@ -14536,11 +14536,11 @@ namespace OpenLoco::World::TrackData
             { { -30, 56, 0 }, 0, Pitch::flat },
             { { -31, 56, 0 }, 0, Pitch::flat },
             { { -32, 56, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4f4c5a
     // Turnaround 1. Lane 0. Track 3. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L0T3R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T3R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::flat },
             { { 1, 24, 0 }, 32, Pitch::flat },
@@ -14616,11 +14616,11 @@ namespace OpenLoco::World::TrackData
             { { 56, 61, 0 }, 16, Pitch::flat },
             { { 56, 62, 0 }, 16, Pitch::flat },
             { { 56, 63, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4f4eac
     // Turnaround 1. Lane 0. Track 3. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L0T3R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T3R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::flat },
             { { 24, 30, 0 }, 48, Pitch::flat },
@@ -14695,11 +14695,11 @@ namespace OpenLoco::World::TrackData
             { { 61, -24, 0 }, 32, Pitch::flat },
             { { 62, -24, 0 }, 32, Pitch::flat },
             { { 63, -24, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4f5340
     // Turnaround 1. Lane 0. Track 3. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA1L0T3R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T3R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::flat },
             { { 8, 1, 0 }, 16, Pitch::flat },
@@ -14775,11 +14775,11 @@ namespace OpenLoco::World::TrackData
             { { 61, 40, 0 }, 32, Pitch::flat },
             { { 62, 40, 0 }, 32, Pitch::flat },
             { { 63, 40, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4f5592
     // Turnaround 1. Lane 0. Track 3. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA1L0T3R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T3R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::flat },
             { { 1, 24, 0 }, 32, Pitch::flat },
@@ -14856,11 +14856,11 @@ namespace OpenLoco::World::TrackData
             { { 40, -30, 0 }, 48, Pitch::flat },
             { { 40, -31, 0 }, 48, Pitch::flat },
             { { 40, -32, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4f57ec
     // Turnaround 1. Lane 0. Track 3. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA1L0T3R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T3R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::flat },
             { { 24, 30, 0 }, 48, Pitch::flat },
@@ -14936,11 +14936,11 @@ namespace OpenLoco::World::TrackData
             { { -30, -8, 0 }, 0, Pitch::flat },
             { { -31, -8, 0 }, 0, Pitch::flat },
             { { -32, -8, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4f50f6
     // Turnaround 1. Lane 0. Track 3. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA1L0T3R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T3R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::flat },
             { { 30, 8, 0 }, 0, Pitch::flat },
@@ -15015,11 +15015,11 @@ namespace OpenLoco::World::TrackData
             { { -8, 61, 0 }, 16, Pitch::flat },
             { { -8, 62, 0 }, 16, Pitch::flat },
             { { -8, 63, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4f015e
     // Turnaround 1. Lane 0. Track 5. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L0T5R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T5R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::up12deg },
             { { 30, 8, 0 }, 0, Pitch::up12deg },
@@ -15085,11 +15085,11 @@ namespace OpenLoco::World::TrackData
             { { -30, 23, 15 }, 0, Pitch::up12deg },
             { { -31, 23, 15 }, 0, Pitch::up12deg },
             { { -32, 23, 15 }, 0, Pitch::up12deg },
-        });
+        }));
 
     // 0x4f0360
     // Turnaround 1. Lane 0. Track 5. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L0T5R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T5R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::up12deg },
             { { 8, 1, 0 }, 16, Pitch::up12deg },
@@ -15155,11 +15155,11 @@ namespace OpenLoco::World::TrackData
             { { 23, 61, 15 }, 16, Pitch::up12deg },
             { { 23, 62, 15 }, 16, Pitch::up12deg },
             { { 23, 63, 15 }, 16, Pitch::up12deg },
-        });
+        }));
 
     // 0x4f0562
     // Turnaround 1. Lane 0. Track 5. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L0T5R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T5R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::up12deg },
             { { 1, 24, 0 }, 32, Pitch::up12deg },
@@ -15225,11 +15225,11 @@ namespace OpenLoco::World::TrackData
             { { 61, 9, 15 }, 32, Pitch::up12deg },
             { { 62, 9, 15 }, 32, Pitch::up12deg },
             { { 63, 9, 15 }, 32, Pitch::up12deg },
-        });
+        }));
 
     // 0x4f0764
     // Turnaround 1. Lane 0. Track 5. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L0T5R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T5R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::up12deg },
             { { 24, 30, 0 }, 48, Pitch::up12deg },
@@ -15295,11 +15295,11 @@ namespace OpenLoco::World::TrackData
             { { 9, -30, 15 }, 48, Pitch::up12deg },
             { { 9, -31, 15 }, 48, Pitch::up12deg },
             { { 9, -32, 15 }, 48, Pitch::up12deg },
-        });
+        }));
 
     // 0x4f0d6a
     // Turnaround 1. Lane 0. Track 5. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA1L0T5R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T5R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::down12deg },
             { { 1, 24, 0 }, 32, Pitch::down12deg },
@@ -15365,11 +15365,11 @@ namespace OpenLoco::World::TrackData
             { { 61, 9, -15 }, 32, Pitch::down12deg },
             { { 62, 9, -15 }, 32, Pitch::down12deg },
             { { 63, 9, -15 }, 32, Pitch::down12deg },
-        });
+        }));
 
     // 0x4f0f6c
     // Turnaround 1. Lane 0. Track 5. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA1L0T5R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T5R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::down12deg },
             { { 24, 30, 0 }, 48, Pitch::down12deg },
@@ -15435,11 +15435,11 @@ namespace OpenLoco::World::TrackData
             { { 9, -30, -15 }, 48, Pitch::down12deg },
             { { 9, -31, -15 }, 48, Pitch::down12deg },
             { { 9, -32, -15 }, 48, Pitch::down12deg },
-        });
+        }));
 
     // 0x4f0966
     // Turnaround 1. Lane 0. Track 5. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA1L0T5R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T5R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::down12deg },
             { { 30, 8, 0 }, 0, Pitch::down12deg },
@@ -15505,11 +15505,11 @@ namespace OpenLoco::World::TrackData
             { { -30, 23, -15 }, 0, Pitch::down12deg },
             { { -31, 23, -15 }, 0, Pitch::down12deg },
             { { -32, 23, -15 }, 0, Pitch::down12deg },
-        });
+        }));
 
     // 0x4f0b68
     // Turnaround 1. Lane 0. Track 5. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA1L0T5R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T5R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::down12deg },
             { { 8, 1, 0 }, 16, Pitch::down12deg },
@@ -15575,11 +15575,11 @@ namespace OpenLoco::World::TrackData
             { { 23, 61, -15 }, 16, Pitch::down12deg },
             { { 23, 62, -15 }, 16, Pitch::down12deg },
             { { 23, 63, -15 }, 16, Pitch::down12deg },
-        });
+        }));
 
     // 0x4f298e
     // Turnaround 1. Lane 0. Track 7. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L0T7R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T7R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::up25deg },
             { { 30, 8, 0 }, 0, Pitch::up25deg },
@@ -15613,11 +15613,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 22, 14 }, 0, Pitch::up25deg },
             { { 1, 23, 15 }, 0, Pitch::up25deg },
             { { 0, 23, 15 }, 0, Pitch::up25deg },
-        });
+        }));
 
     // 0x4f2a90
     // Turnaround 1. Lane 0. Track 7. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L0T7R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T7R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::up25deg },
             { { 8, 1, 0 }, 16, Pitch::up25deg },
@@ -15651,11 +15651,11 @@ namespace OpenLoco::World::TrackData
             { { 22, 29, 14 }, 16, Pitch::up25deg },
             { { 23, 30, 15 }, 16, Pitch::up25deg },
             { { 23, 31, 15 }, 16, Pitch::up25deg },
-        });
+        }));
 
     // 0x4f2b92
     // Turnaround 1. Lane 0. Track 7. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L0T7R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T7R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::up25deg },
             { { 1, 24, 0 }, 32, Pitch::up25deg },
@@ -15689,11 +15689,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 10, 14 }, 32, Pitch::up25deg },
             { { 30, 9, 15 }, 32, Pitch::up25deg },
             { { 31, 9, 15 }, 32, Pitch::up25deg },
-        });
+        }));
 
     // 0x4f2c94
     // Turnaround 1. Lane 0. Track 7. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L0T7R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T7R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::up25deg },
             { { 24, 30, 0 }, 48, Pitch::up25deg },
@@ -15727,11 +15727,11 @@ namespace OpenLoco::World::TrackData
             { { 10, 2, 14 }, 48, Pitch::up25deg },
             { { 9, 1, 15 }, 48, Pitch::up25deg },
             { { 9, 0, 15 }, 48, Pitch::up25deg },
-        });
+        }));
 
     // 0x4f2f9a
     // Turnaround 1. Lane 0. Track 7. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA1L0T7R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T7R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 24, 0 }, 32, Pitch::down25deg },
             { { 1, 24, 0 }, 32, Pitch::down25deg },
@@ -15765,11 +15765,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 10, -14 }, 32, Pitch::down25deg },
             { { 30, 9, -15 }, 32, Pitch::down25deg },
             { { 31, 9, -15 }, 32, Pitch::down25deg },
-        });
+        }));
 
     // 0x4f309c
     // Turnaround 1. Lane 0. Track 7. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA1L0T7R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T7R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 31, 0 }, 48, Pitch::down25deg },
             { { 24, 30, 0 }, 48, Pitch::down25deg },
@@ -15803,11 +15803,11 @@ namespace OpenLoco::World::TrackData
             { { 10, 2, -14 }, 48, Pitch::down25deg },
             { { 9, 1, -15 }, 48, Pitch::down25deg },
             { { 9, 0, -15 }, 48, Pitch::down25deg },
-        });
+        }));
 
     // 0x4f2d96
     // Turnaround 1. Lane 0. Track 7. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA1L0T7R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T7R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 8, 0 }, 0, Pitch::down25deg },
             { { 30, 8, 0 }, 0, Pitch::down25deg },
@@ -15841,11 +15841,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 22, -14 }, 0, Pitch::down25deg },
             { { 1, 23, -15 }, 0, Pitch::down25deg },
             { { 0, 23, -15 }, 0, Pitch::down25deg },
-        });
+        }));
 
     // 0x4f2e98
     // Turnaround 1. Lane 0. Track 7. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA1L0T7R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L0T7R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 0, 0 }, 16, Pitch::down25deg },
             { { 8, 1, 0 }, 16, Pitch::down25deg },
@@ -15879,11 +15879,11 @@ namespace OpenLoco::World::TrackData
             { { 22, 29, -14 }, 16, Pitch::down25deg },
             { { 23, 30, -15 }, 16, Pitch::down25deg },
             { { 23, 31, -15 }, 16, Pitch::down25deg },
-        });
+        }));
 
     // 0x4f2586
     // Turnaround 1. Lane 1. Track 0. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L1T0R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T0R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::flat },
             { { 30, 24, 0 }, 0, Pitch::flat },
@@ -15917,11 +15917,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 10, 0 }, 0, Pitch::flat },
             { { 1, 9, 0 }, 0, Pitch::flat },
             { { 0, 9, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4f2688
     // Turnaround 1. Lane 1. Track 0. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L1T0R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T0R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::flat },
             { { 24, 1, 0 }, 16, Pitch::flat },
@@ -15955,11 +15955,11 @@ namespace OpenLoco::World::TrackData
             { { 10, 29, 0 }, 16, Pitch::flat },
             { { 9, 30, 0 }, 16, Pitch::flat },
             { { 9, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4f278a
     // Turnaround 1. Lane 1. Track 0. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L1T0R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T0R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::flat },
             { { 1, 8, 0 }, 32, Pitch::flat },
@@ -15993,11 +15993,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 22, 0 }, 32, Pitch::flat },
             { { 30, 23, 0 }, 32, Pitch::flat },
             { { 31, 23, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4f288c
     // Turnaround 1. Lane 1. Track 0. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L1T0R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T0R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::flat },
             { { 8, 30, 0 }, 48, Pitch::flat },
@@ -16031,11 +16031,11 @@ namespace OpenLoco::World::TrackData
             { { 22, 2, 0 }, 48, Pitch::flat },
             { { 23, 1, 0 }, 48, Pitch::flat },
             { { 23, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4f4508
     // Turnaround 1. Lane 1. Track 1. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L1T1R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T1R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::flat },
             { { 30, 24, 0 }, 0, Pitch::flat },
@@ -16065,11 +16065,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 2, 0 }, 48, Pitch::flat },
             { { 24, 1, 0 }, 48, Pitch::flat },
             { { 24, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4f45ea
     // Turnaround 1. Lane 1. Track 1. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L1T1R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T1R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::flat },
             { { 24, 1, 0 }, 16, Pitch::flat },
@@ -16099,11 +16099,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 8, 0 }, 0, Pitch::flat },
             { { 1, 8, 0 }, 0, Pitch::flat },
             { { 0, 8, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4f46cc
     // Turnaround 1. Lane 1. Track 1. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L1T1R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T1R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::flat },
             { { 1, 8, 0 }, 32, Pitch::flat },
@@ -16133,11 +16133,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 29, 0 }, 16, Pitch::flat },
             { { 8, 30, 0 }, 16, Pitch::flat },
             { { 8, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4f442e
     // Turnaround 1. Lane 1. Track 1. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L1T1R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T1R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::flat },
             { { 8, 30, 0 }, 48, Pitch::flat },
@@ -16166,11 +16166,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 24, 0 }, 32, Pitch::flat },
             { { 30, 24, 0 }, 32, Pitch::flat },
             { { 31, 24, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4f40ae
     // Turnaround 1. Lane 1. Track 1. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA1L1T1R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T1R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::flat },
             { { 24, 1, 0 }, 16, Pitch::flat },
@@ -16200,11 +16200,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 24, 0 }, 30, Pitch::flat },
             { { 30, 24, 0 }, 32, Pitch::flat },
             { { 31, 24, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4f4190
     // Turnaround 1. Lane 1. Track 1. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA1L1T1R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T1R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::flat },
             { { 1, 8, 0 }, 32, Pitch::flat },
@@ -16234,11 +16234,11 @@ namespace OpenLoco::World::TrackData
             { { 24, 2, 0 }, 46, Pitch::flat },
             { { 24, 1, 0 }, 48, Pitch::flat },
             { { 24, 0, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4f4272
     // Turnaround 1. Lane 1. Track 1. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA1L1T1R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T1R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::flat },
             { { 8, 30, 0 }, 48, Pitch::flat },
@@ -16268,11 +16268,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 8, 0 }, 0, Pitch::flat },
             { { 1, 8, 0 }, 0, Pitch::flat },
             { { 0, 8, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4f4354
     // Turnaround 1. Lane 1. Track 1. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA1L1T1R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T1R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::flat },
             { { 30, 24, 0 }, 0, Pitch::flat },
@@ -16301,11 +16301,11 @@ namespace OpenLoco::World::TrackData
             { { 8, 29, 0 }, 14, Pitch::flat },
             { { 8, 30, 0 }, 16, Pitch::flat },
             { { 8, 31, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4f65d0
     // Turnaround 1. Lane 1. Track 3. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L1T3R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T3R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::flat },
             { { 30, 24, 0 }, 0, Pitch::flat },
@@ -16381,11 +16381,11 @@ namespace OpenLoco::World::TrackData
             { { -8, -30, 0 }, 48, Pitch::flat },
             { { -8, -31, 0 }, 48, Pitch::flat },
             { { -8, -32, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4f6822
     // Turnaround 1. Lane 1. Track 3. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L1T3R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T3R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::flat },
             { { 24, 1, 0 }, 16, Pitch::flat },
@@ -16462,11 +16462,11 @@ namespace OpenLoco::World::TrackData
             { { -30, 40, 0 }, 0, Pitch::flat },
             { { -31, 40, 0 }, 0, Pitch::flat },
             { { -32, 40, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4f6a7c
     // Turnaround 1. Lane 1. Track 3. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L1T3R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T3R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::flat },
             { { 1, 8, 0 }, 32, Pitch::flat },
@@ -16542,11 +16542,11 @@ namespace OpenLoco::World::TrackData
             { { 40, 61, 0 }, 16, Pitch::flat },
             { { 40, 62, 0 }, 16, Pitch::flat },
             { { 40, 63, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4f6386
     // Turnaround 1. Lane 1. Track 3. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L1T3R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T3R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::flat },
             { { 8, 30, 0 }, 48, Pitch::flat },
@@ -16621,11 +16621,11 @@ namespace OpenLoco::World::TrackData
             { { 61, -8, 0 }, 32, Pitch::flat },
             { { 62, -8, 0 }, 32, Pitch::flat },
             { { 63, -8, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4f5a3e
     // Turnaround 1. Lane 1. Track 3. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA1L1T3R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T3R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::flat },
             { { 24, 1, 0 }, 16, Pitch::flat },
@@ -16701,11 +16701,11 @@ namespace OpenLoco::World::TrackData
             { { 61, 56, 0 }, 32, Pitch::flat },
             { { 62, 56, 0 }, 32, Pitch::flat },
             { { 63, 56, 0 }, 32, Pitch::flat },
-        });
+        }));
 
     // 0x4f5c90
     // Turnaround 1. Lane 1. Track 3. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA1L1T3R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T3R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::flat },
             { { 1, 8, 0 }, 32, Pitch::flat },
@@ -16782,11 +16782,11 @@ namespace OpenLoco::World::TrackData
             { { 56, -30, 0 }, 48, Pitch::flat },
             { { 56, -31, 0 }, 48, Pitch::flat },
             { { 56, -32, 0 }, 48, Pitch::flat },
-        });
+        }));
 
     // 0x4f5eea
     // Turnaround 1. Lane 1. Track 3. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA1L1T3R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T3R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::flat },
             { { 8, 30, 0 }, 48, Pitch::flat },
@@ -16862,11 +16862,11 @@ namespace OpenLoco::World::TrackData
             { { -30, -24, 0 }, 0, Pitch::flat },
             { { -31, -24, 0 }, 0, Pitch::flat },
             { { -32, -24, 0 }, 0, Pitch::flat },
-        });
+        }));
 
     // 0x4f613c
     // Turnaround 1. Lane 1. Track 3. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA1L1T3R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T3R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::flat },
             { { 30, 24, 0 }, 0, Pitch::flat },
@@ -16941,11 +16941,11 @@ namespace OpenLoco::World::TrackData
             { { -24, 61, 0 }, 16, Pitch::flat },
             { { -24, 62, 0 }, 16, Pitch::flat },
             { { -24, 63, 0 }, 16, Pitch::flat },
-        });
+        }));
 
     // 0x4f116e
     // Turnaround 1. Lane 1. Track 5. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L1T5R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T5R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::up12deg },
             { { 30, 24, 0 }, 0, Pitch::up12deg },
@@ -17011,11 +17011,11 @@ namespace OpenLoco::World::TrackData
             { { -30, 9, 15 }, 0, Pitch::up12deg },
             { { -31, 9, 15 }, 0, Pitch::up12deg },
             { { -32, 9, 15 }, 0, Pitch::up12deg },
-        });
+        }));
 
     // 0x4f1370
     // Turnaround 1. Lane 1. Track 5. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L1T5R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T5R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::up12deg },
             { { 24, 1, 0 }, 16, Pitch::up12deg },
@@ -17081,11 +17081,11 @@ namespace OpenLoco::World::TrackData
             { { 9, 61, 15 }, 16, Pitch::up12deg },
             { { 9, 62, 15 }, 16, Pitch::up12deg },
             { { 9, 63, 15 }, 16, Pitch::up12deg },
-        });
+        }));
 
     // 0x4f1572
     // Turnaround 1. Lane 1. Track 5. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L1T5R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T5R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::up12deg },
             { { 1, 8, 0 }, 32, Pitch::up12deg },
@@ -17151,11 +17151,11 @@ namespace OpenLoco::World::TrackData
             { { 61, 23, 15 }, 32, Pitch::up12deg },
             { { 62, 23, 15 }, 32, Pitch::up12deg },
             { { 63, 23, 15 }, 32, Pitch::up12deg },
-        });
+        }));
 
     // 0x4f1774
     // Turnaround 1. Lane 1. Track 5. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L1T5R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T5R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::up12deg },
             { { 8, 30, 0 }, 48, Pitch::up12deg },
@@ -17221,11 +17221,11 @@ namespace OpenLoco::World::TrackData
             { { 23, -30, 15 }, 48, Pitch::up12deg },
             { { 23, -31, 15 }, 48, Pitch::up12deg },
             { { 23, -32, 15 }, 48, Pitch::up12deg },
-        });
+        }));
 
     // 0x4f1d7a
     // Turnaround 1. Lane 1. Track 5. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA1L1T5R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T5R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::down12deg },
             { { 1, 8, 0 }, 32, Pitch::down12deg },
@@ -17291,11 +17291,11 @@ namespace OpenLoco::World::TrackData
             { { 61, 23, -15 }, 32, Pitch::down12deg },
             { { 62, 23, -15 }, 32, Pitch::down12deg },
             { { 63, 23, -15 }, 32, Pitch::down12deg },
-        });
+        }));
 
     // 0x4f1f7c
     // Turnaround 1. Lane 1. Track 5. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA1L1T5R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T5R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::down12deg },
             { { 8, 30, 0 }, 48, Pitch::down12deg },
@@ -17361,11 +17361,11 @@ namespace OpenLoco::World::TrackData
             { { 23, -30, -15 }, 48, Pitch::down12deg },
             { { 23, -31, -15 }, 48, Pitch::down12deg },
             { { 23, -32, -15 }, 48, Pitch::down12deg },
-        });
+        }));
 
     // 0x4f1976
     // Turnaround 1. Lane 1. Track 5. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA1L1T5R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T5R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::down12deg },
             { { 30, 24, 0 }, 0, Pitch::down12deg },
@@ -17431,11 +17431,11 @@ namespace OpenLoco::World::TrackData
             { { -30, 9, -15 }, 0, Pitch::down12deg },
             { { -31, 9, -15 }, 0, Pitch::down12deg },
             { { -32, 9, -15 }, 0, Pitch::down12deg },
-        });
+        }));
 
     // 0x4f1b78
     // Turnaround 1. Lane 1. Track 5. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA1L1T5R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T5R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::down12deg },
             { { 24, 1, 0 }, 16, Pitch::down12deg },
@@ -17501,11 +17501,11 @@ namespace OpenLoco::World::TrackData
             { { 9, 61, -15 }, 16, Pitch::down12deg },
             { { 9, 62, -15 }, 16, Pitch::down12deg },
             { { 9, 63, -15 }, 16, Pitch::down12deg },
-        });
+        }));
 
     // 0x4f319e
     // Turnaround 1. Lane 1. Track 7. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L1T7R0D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T7R0D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::up25deg },
             { { 30, 24, 0 }, 0, Pitch::up25deg },
@@ -17539,11 +17539,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 10, 14 }, 0, Pitch::up25deg },
             { { 1, 9, 15 }, 0, Pitch::up25deg },
             { { 0, 9, 15 }, 0, Pitch::up25deg },
-        });
+        }));
 
     // 0x4f32a0
     // Turnaround 1. Lane 1. Track 7. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L1T7R0D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T7R0D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::up25deg },
             { { 24, 1, 0 }, 16, Pitch::up25deg },
@@ -17577,11 +17577,11 @@ namespace OpenLoco::World::TrackData
             { { 10, 29, 14 }, 16, Pitch::up25deg },
             { { 9, 30, 15 }, 16, Pitch::up25deg },
             { { 9, 31, 15 }, 16, Pitch::up25deg },
-        });
+        }));
 
     // 0x4f33a2
     // Turnaround 1. Lane 1. Track 7. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L1T7R0D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T7R0D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::up25deg },
             { { 1, 8, 0 }, 32, Pitch::up25deg },
@@ -17615,11 +17615,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 22, 14 }, 32, Pitch::up25deg },
             { { 30, 23, 15 }, 32, Pitch::up25deg },
             { { 31, 23, 15 }, 32, Pitch::up25deg },
-        });
+        }));
 
     // 0x4f34a4
     // Turnaround 1. Lane 1. Track 7. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L1T7R0D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T7R0D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::up25deg },
             { { 8, 30, 0 }, 48, Pitch::up25deg },
@@ -17653,11 +17653,11 @@ namespace OpenLoco::World::TrackData
             { { 22, 2, 14 }, 48, Pitch::up25deg },
             { { 23, 1, 15 }, 48, Pitch::up25deg },
             { { 23, 0, 15 }, 48, Pitch::up25deg },
-        });
+        }));
 
     // 0x4f37aa
     // Turnaround 1. Lane 1. Track 7. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA1L1T7R1D0 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T7R1D0 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 0, 8, 0 }, 32, Pitch::down25deg },
             { { 1, 8, 0 }, 32, Pitch::down25deg },
@@ -17691,11 +17691,11 @@ namespace OpenLoco::World::TrackData
             { { 29, 22, -14 }, 32, Pitch::down25deg },
             { { 30, 23, -15 }, 32, Pitch::down25deg },
             { { 31, 23, -15 }, 32, Pitch::down25deg },
-        });
+        }));
 
     // 0x4f38ac
     // Turnaround 1. Lane 1. Track 7. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA1L1T7R1D1 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T7R1D1 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 8, 31, 0 }, 48, Pitch::down25deg },
             { { 8, 30, 0 }, 48, Pitch::down25deg },
@@ -17729,11 +17729,11 @@ namespace OpenLoco::World::TrackData
             { { 22, 2, -14 }, 48, Pitch::down25deg },
             { { 23, 1, -15 }, 48, Pitch::down25deg },
             { { 23, 0, -15 }, 48, Pitch::down25deg },
-        });
+        }));
 
     // 0x4f35a6
     // Turnaround 1. Lane 1. Track 7. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA1L1T7R1D2 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T7R1D2 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 31, 24, 0 }, 0, Pitch::down25deg },
             { { 30, 24, 0 }, 0, Pitch::down25deg },
@@ -17767,11 +17767,11 @@ namespace OpenLoco::World::TrackData
             { { 2, 10, -14 }, 0, Pitch::down25deg },
             { { 1, 9, -15 }, 0, Pitch::down25deg },
             { { 0, 9, -15 }, 0, Pitch::down25deg },
-        });
+        }));
 
     // 0x4f36a8
     // Turnaround 1. Lane 1. Track 7. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA1L1T7R1D3 = std::to_array<MoveInfo>(
+    static constexpr auto moveInfoTA1L1T7R1D3 = packMoveInfo(std::to_array<MoveInfo>(
         {
             { { 24, 0, 0 }, 16, Pitch::down25deg },
             { { 24, 1, 0 }, 16, Pitch::down25deg },
@@ -17805,12 +17805,12 @@ namespace OpenLoco::World::TrackData
             { { 10, 29, -14 }, 16, Pitch::down25deg },
             { { 9, 30, -15 }, 16, Pitch::down25deg },
             { { 9, 31, -15 }, 16, Pitch::down25deg },
-        });
+        }));
 
 #pragma endregion
 
     // 0x004D9724 44 track ids * 8 directions
-    static constexpr auto _4D9724 = std::to_array<std::span<const MoveInfo>>({
+    static constexpr auto _4D9724 = std::to_array<std::span<const PackedMoveInfo>>({
         moveInfoT0R0D0,
         moveInfoT0R0D1,
         moveInfoT0R0D2,
@@ -18166,9 +18166,9 @@ namespace OpenLoco::World::TrackData
     });
 
     // 0x004D9DE4
-    static constexpr std::array<std::array<std::array<std::span<const MoveInfo>, 10 * 8>, 2>, 2> _4D9DE4 = {
-        std::array<std::array<std::span<const MoveInfo>, 10 * 8>, 2>{
-            std::array<std::span<const MoveInfo>, 10 * 8>{
+    static constexpr std::array<std::array<std::array<std::span<const PackedMoveInfo>, 10 * 8>, 2>, 2> _4D9DE4 = {
+        std::array<std::array<std::span<const PackedMoveInfo>, 10 * 8>, 2>{
+            std::array<std::span<const PackedMoveInfo>, 10 * 8>{
                 moveInfoTA0L0T0R0D0,
                 moveInfoTA0L0T0R0D1,
                 moveInfoTA0L0T0R0D2,
@@ -18333,8 +18333,8 @@ namespace OpenLoco::World::TrackData
                 moveInfoTA0L1T9R0D3,
             },
         },
-        std::array<std::array<std::span<const MoveInfo>, 10 * 8>, 2>{
-            std::array<std::span<const MoveInfo>, 10 * 8>{
+        std::array<std::array<std::span<const PackedMoveInfo>, 10 * 8>, 2>{
+            std::array<std::span<const PackedMoveInfo>, 10 * 8>{
                 moveInfoTA1L0T0R0D0,
                 moveInfoTA1L0T0R0D1,
                 moveInfoTA1L0T0R0D2,
@@ -18502,9 +18502,9 @@ namespace OpenLoco::World::TrackData
     };
 
     // 0x004D9DE4
-    static constexpr std::array<std::array<std::array<std::span<const MoveInfo>, 10 * 8>, 2>, 2> _rightHand4D9DE4 = {
-        std::array<std::array<std::span<const MoveInfo>, 10 * 8>, 2>{
-            std::array<std::span<const MoveInfo>, 10 * 8>{
+    static constexpr std::array<std::array<std::array<std::span<const PackedMoveInfo>, 10 * 8>, 2>, 2> _rightHand4D9DE4 = {
+        std::array<std::array<std::span<const PackedMoveInfo>, 10 * 8>, 2>{
+            std::array<std::span<const PackedMoveInfo>, 10 * 8>{
                 moveInfoTA0L1T0R0D0,
                 moveInfoTA0L1T0R0D1,
                 moveInfoTA0L1T0R0D2,
@@ -18670,8 +18670,8 @@ namespace OpenLoco::World::TrackData
             },
 
         },
-        std::array<std::array<std::span<const MoveInfo>, 10 * 8>, 2>{
-            std::array<std::span<const MoveInfo>, 10 * 8>{
+        std::array<std::array<std::span<const PackedMoveInfo>, 10 * 8>, 2>{
+            std::array<std::span<const PackedMoveInfo>, 10 * 8>{
                 moveInfoTA1L1T0R0D0,
                 moveInfoTA1L1T0R0D1,
                 moveInfoTA1L1T0R0D2,
@@ -18839,7 +18839,7 @@ namespace OpenLoco::World::TrackData
     };
 
     // 0x4D9CA4 - 10 roadId's * 8 directions
-    static constexpr auto kRoadPlacementSubPositions = std::to_array<std::span<const MoveInfo>>({
+    static constexpr auto kRoadPlacementSubPositions = std::to_array<std::span<const PackedMoveInfo>>({
         moveInfoT0R0D0,
         moveInfoT0R0D1,
         moveInfoT0R0D2,
@@ -18922,7 +18922,7 @@ namespace OpenLoco::World::TrackData
         moveInfoT42R1D3,
     });
 
-    std::span<const MoveInfo> getRoadSubPositon(const uint16_t trackAndDirection)
+    MoveInfoSpan getRoadSubPositon(const uint16_t trackAndDirection)
     {
         // TODO: rework after 0x0047D9F2 is implemented and hooked
         // 0x005253B0
@@ -18930,12 +18930,12 @@ namespace OpenLoco::World::TrackData
         return data[trackAndDirection & (1 << 8) ? 1 : 0][trackAndDirection & (1 << 7) ? 1 : 0][trackAndDirection & 0x7F];
     }
 
-    std::span<const MoveInfo> getTrackSubPositon(const uint16_t trackAndDirection)
+    MoveInfoSpan getTrackSubPositon(const uint16_t trackAndDirection)
     {
         return _4D9724[trackAndDirection];
     }
 
-    std::span<const MoveInfo> getRoadPlacementSubPositon(const uint16_t trackAndDirection)
+    MoveInfoSpan getRoadPlacementSubPositon(const uint16_t trackAndDirection)
     {
         // TODO: investigate if this mirrors one side of getRoadSubPositon
         return kRoadPlacementSubPositions[trackAndDirection];
@@ -345,6 +345,18 @@ namespace OpenLoco::World::Track
         return result;
     }
 
+    static uint32_t _trackNetworkRevision = 0;
+
+    void invalidateTrackNetwork()
+    {
+        _trackNetworkRevision++;
+    }
+
+    uint32_t getTrackNetworkRevision()
+    {
+        return _trackNetworkRevision;
+    }
+
     // 0x004A2820, 0x004A2854
     // For 0x004A2820 call getTrackConnectionEnd first then this
     TrackConnections getTrackConnectionsAi(const World::Pos3& nextTrackPos, const uint8_t nextRotation, const CompanyId company, const uint8_t trackObjectId, const uint8_t requiredMods, const uint8_t queryMods)
@@ -1,5 +1,6 @@
 #include "Objects/ObjectImageTable.h"
 #include "Graphics/Gfx.h"
+#include "Graphics/SpriteCache.h"
 #include <OpenLoco/Core/Exception.hpp>
 
 namespace OpenLoco::ObjectManager
@@ -28,6 +29,8 @@ namespace OpenLoco::ObjectManager
         remainingData = remainingData.subspan(sizeof(Gfx::G1Element32) * g1Header.numEntries);
         // Urgh messy...
         auto* const imageDataBegin = const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(remainingData.data()));
+        // The image data may reuse the memory of an unloaded object
+        Gfx::SpriteCache::invalidate();
 
         for (uint32_t i = 0; i < g1Header.numEntries; ++i, ++g32Ptr)
         {
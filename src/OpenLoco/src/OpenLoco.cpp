@@ -3,6 +3,7 @@
 #include <cassert>
 #include <chrono>
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <thread>
@@ -21,6 +22,7 @@
 #endif
 
 #include "Audio/Audio.h"
+#include "Benchmark.h"
 #include "Config.h"
 #include "Entities/EntityManager.h"
 #include "Entities/EntityTweener.h"
@@ -56,6 +58,7 @@
 #include "ViewportManager.h"
 #include "World/CompanyManager.h"
 #include <OpenLoco/Core/Numerics.hpp>
+#include <OpenLoco/Diagnostics/Profiler.h>
 #include <OpenLoco/Platform/Crash.h>
 #include <OpenLoco/Platform/Platform.h>
 #include <OpenLoco/Version.hpp>
@@ -423,7 +426,7 @@ namespace OpenLoco
         return _numFrameUpdates;
     }
 
-    void simulateGame(const fs::path& savePath, int32_t ticks)
+    static bool loadGameForSimulation(const fs::path& savePath)
     {
         try
         {
@@ -441,12 +444,16 @@ namespace OpenLoco
         if (SceneManager::getCurrentScene() != SceneManager::SceneId::gameplay)
         {
             Logging::error("Unable to simulate park!");
-            return;
+            return false;
         }
 
-        Logging::info("File loaded. Starting simulation.");
+        return true;
+    }
 
-        for (int32_t i = 0; i < ticks; i++)
+    static int32_t simulateTicks(int32_t ticks)
+    {
+        int32_t i = 0;
+        for (; i < ticks; i++)
         {
             if (SceneManager::isSceneTransitionPending())
             {
@@ -455,6 +462,83 @@ namespace OpenLoco
 
             Scenes::GameScene::tick();
         }
+        return i;
+    }
+
+    static void logTileFragmentation()
+    {
+        const auto stats = World::TileManager::getFragmentationStats();
+        Logging::info(
+            "Tile elements: end {}, {} free entries in {} runs, largest run {}.",
+            stats.entriesEnd,
+            stats.freeEntries,
+            stats.freeRuns,
+            stats.largestFreeRun);
+    }
+
+    void simulateGame(const fs::path& savePath, int32_t ticks)
+    {
+        if (!loadGameForSimulation(savePath))
+        {
+            return;
+        }
+
+        Logging::info("File loaded. Starting simulation.");
+
+        simulateTicks(ticks);
+        logTileFragmentation();
+    }
+
+    bool benchmarkGame(const fs::path& savePath, int32_t ticks, const fs::path& reportPath, const fs::path& tracePath)
+    {
+        if (!loadGameForSimulation(savePath))
+        {
+            return false;
+        }
+
+        Logging::info("File loaded. Starting benchmark of {} ticks.", ticks);
+
+        if (!tracePath.empty())
+        {
+            Profiler::beginCapture();
+        }
+
+        Benchmark::startRecording(static_cast<uint32_t>(std::max(ticks, 0)));
+        const auto ticksRun = simulateTicks(ticks);
+        Benchmark::stopRecording();
+
+        if (!tracePath.empty())
+        {
+            Profiler::endCapture();
+            if (!Profiler::exportChromeTrace(tracePath))
+            {
+                Logging::error("Unable to write profiler trace to {}", tracePath.u8string());
+            }
+        }
+
+        if (ticksRun != ticks)
+        {
+            Logging::warn("Benchmark stopped early after {} ticks.", ticksRun);
+        }
+
+        Benchmark::logReport();
+        logTileFragmentation();
+
+        const auto report = Benchmark::getReportJson(savePath);
+        if (reportPath.empty())
+        {
+            std::cout << report;
+            return true;
+        }
+
+        std::ofstream stream(reportPath);
+        if (!stream.is_open())
+        {
+            Logging::error("Unable to write benchmark report to {}", reportPath.u8string());
+            return false;
+        }
+        stream << report;
+        return true;
     }
 
 }
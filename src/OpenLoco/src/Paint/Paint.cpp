@@ -19,20 +19,66 @@
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Core/Numerics.hpp>
+#include <OpenLoco/Diagnostics/Profiler.h>
+#include <atomic>
+#include <cassert>
 
 using namespace OpenLoco::Ui::ViewportInteraction;
 
 namespace OpenLoco::Paint
 {
+    static std::atomic<uint64_t> _arenaHeapAllocations;
+    static std::atomic<size_t> _arenaReservedBytes;
+
+    // Sessions on a thread end in the reverse order they were created in, so each thread
+    // keeps its arenas as a stack.
+    struct PaintArenaStack
+    {
+        std::vector<std::unique_ptr<PaintArena>> arenas;
+        size_t numInUse = 0;
+    };
+    static thread_local PaintArenaStack _arenaStack;
+
+    static PaintArena& acquireArena()
+    {
+        if (_arenaStack.numInUse == _arenaStack.arenas.size())
+        {
+            _arenaStack.arenas.push_back(std::make_unique<PaintArena>());
+            _arenaHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+            _arenaReservedBytes.fetch_add(sizeof(PaintArena), std::memory_order_relaxed);
+        }
+        return *_arenaStack.arenas[_arenaStack.numInUse++];
+    }
+
+    static void releaseArena(PaintArena& arena)
+    {
+        assert(_arenaStack.numInUse > 0 && _arenaStack.arenas[_arenaStack.numInUse - 1].get() == &arena);
+        arena.reset();
+        _arenaStack.numInUse--;
+    }
+
+    void PaintArena::addChunk()
+    {
+        _chunks.push_back(std::make_unique<PaintEntry[]>(kChunkSize));
+        _arenaHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+        _arenaReservedBytes.fetch_add(sizeof(PaintEntry) * kChunkSize, std::memory_order_relaxed);
+    }
+
+    PaintArenaStats getPaintArenaStats()
+    {
+        return PaintArenaStats{
+            _arenaHeapAllocations.load(std::memory_order_relaxed),
+            _arenaReservedBytes.load(std::memory_order_relaxed),
+        };
+    }
+
     PaintSession::PaintSession(const Gfx::RenderTarget& rt, ZoomLevel zoom, const SessionOptions& options)
+        : _arena(acquireArena())
+        , _quadrants(_arena.quadrants)
     {
         _renderTarget = &rt;
         _zoom = zoom;
         _lastPS = nullptr;
-        for (auto& quadrant : _quadrants)
-        {
-            quadrant = nullptr;
-        }
         _quadrantBackIndex = std::numeric_limits<uint32_t>::max();
         _quadrantFrontIndex = 0;
         _lastPaintString = nullptr;
@@ -47,6 +93,16 @@ namespace OpenLoco::Paint
         _foregroundCullingHeight = options.foregroundCullHeight;
     }
 
+    PaintSession::~PaintSession()
+    {
+        // Only the quadrants between the back and front index can have been used
+        if (_quadrantBackIndex != std::numeric_limits<uint32_t>::max())
+        {
+            std::fill(_quadrants.begin() + _quadrantBackIndex, _quadrants.begin() + _quadrantFrontIndex + 1, nullptr);
+        }
+        releaseArena(_arena);
+    }
+
     // Magnifying zoom levels have several screen pixels per world unit, so the far
     // edges have to round outwards to still cover every pixel of the render target.
     static constexpr int32_t screenToWorldCeil(ZoomLevel zoom, int32_t value)
@@ -640,6 +696,8 @@ namespace OpenLoco::Paint
     // 0x004622A2
     void PaintSession::generate()
     {
+        OPENLOCO_PROFILE_ZONE("PaintSession::generate");
+
         if (!Game::hasFlags(GameStateFlags::tileManagerLoaded))
         {
             return;
@@ -836,6 +894,8 @@ namespace OpenLoco::Paint
     // 0x0045E7B5
     void PaintSession::arrangeStructs()
     {
+        OPENLOCO_PROFILE_ZONE("PaintSession::arrangeStructs");
+
         PaintStruct psHead{};
 
         auto* ps = &psHead;
@@ -1072,6 +1132,8 @@ namespace OpenLoco::Paint
     // 0x0045EA23
     void PaintSession::drawStructs(Gfx::DrawingContext& drawingCtx)
     {
+        OPENLOCO_PROFILE_ZONE("PaintSession::drawStructs");
+
         const auto zoom = _zoom;
 
         for (const auto* ps = _paintHead; ps != nullptr; ps = ps->nextQuadrantPS)
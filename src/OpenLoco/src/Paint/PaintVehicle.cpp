@@ -1,5 +1,6 @@
 #include "Paint/PaintVehicle.h"
 #include "Config.h"
+#include "Entities/EntityManager.h"
 #include "Graphics/Colour.h"
 #include "Objects/ObjectManager.h"
 #include "Objects/VehicleObject.h"
@@ -10,6 +11,7 @@
 #include "Vehicles/VehicleBody.h"
 #include "Vehicles/VehicleBogie.h"
 #include "Vehicles/VehicleDraw.h"
+#include "Vehicles/VehicleHead.h"
 #include "World/CompanyManager.h"
 #include <OpenLoco/Math/Trigonometry.hpp>
 
@@ -302,8 +304,14 @@ namespace OpenLoco::Paint
 
         if (brakingImageIndex)
         {
-            Vehicle train(body->head);
-            if (train.veh2->brakeLightTimeout != 0
+            // Painting runs on several threads, so walk to veh2 rather than building a Vehicle which
+            // updates the shared train composition records
+            auto* head = EntityManager::get<VehicleHead>(body->head);
+            auto* veh1 = head != nullptr ? head->nextVehicleComponent() : nullptr;
+            auto* component = veh1 != nullptr ? veh1->nextVehicleComponent() : nullptr;
+            const auto* veh2 = component != nullptr ? component->asVehicle2() : nullptr;
+            if (veh2 != nullptr
+                && veh2->brakeLightTimeout != 0
                 && !body->has38Flags(Flags38::isGhost)
                 && !body->hasVehicleFlags(VehicleFlags::unk_5))
             {
@@ -356,6 +356,7 @@ namespace OpenLoco::S5
 
         ts.entriesEnd = static_cast<std::ptrdiff_t>(count);
         World::TileManager::updateTilePointers();
+        resetCargoContributions();
     }
 
     /**
@@ -464,32 +465,39 @@ namespace OpenLoco::S5
             WindowManager::closeConstructionWindows();
         }
 
-        if ((flags & SaveFlags::raw) == SaveFlags::none)
-        {
-            TileManager::reorganise();
-            EntityManager::resetSpatialIndex();
-            EntityManager::zeroUnused();
-            StationManager::zeroUnused();
-            Vehicles::OrderManager::zeroUnusedOrderTable();
-        }
-
-        if ((flags & SaveFlags::isAutosave) == SaveFlags::none)
-        {
-            Ui::ProgressBar::setProgress(40);
-        }
-
         bool saveResult;
         {
-            auto requiredObjects = ObjectManager::getHeaders();
+            std::unique_ptr<S5File> file;
             std::vector<ObjectHeader> packedObjects;
-            if (shouldPackObjects(flags))
             {
-                std::copy_if(requiredObjects.begin(), requiredObjects.end(), std::back_inserter(packedObjects), [](ObjectHeader& header) {
-                    return !header.isEmpty() && !header.isVanilla();
-                });
-            }
+                Vehicles::OrderManager::ScopedOrderTableExport orderTableExport;
 
-            auto file = prepareGameState(flags, requiredObjects, packedObjects);
+                if ((flags & SaveFlags::raw) == SaveFlags::none)
+                {
+                    // Nothing holds element references while saving, so the stores can be moved as well
+                    TileManager::repackElementStores();
+                    Ui::Windows::Terraform::setLastPlacedTree(nullptr);
+                    EntityManager::resetSpatialIndex();
+                    EntityManager::zeroUnused();
+                    StationManager::zeroUnused();
+                    Vehicles::OrderManager::zeroUnusedOrderTable();
+                }
+
+                if ((flags & SaveFlags::isAutosave) == SaveFlags::none)
+                {
+                    Ui::ProgressBar::setProgress(40);
+                }
+
+                auto requiredObjects = ObjectManager::getHeaders();
+                if (shouldPackObjects(flags))
+                {
+                    std::copy_if(requiredObjects.begin(), requiredObjects.end(), std::back_inserter(packedObjects), [](ObjectHeader& header) {
+                        return !header.isEmpty() && !header.isVanilla();
+                    });
+                }
+
+                file = prepareGameState(flags, requiredObjects, packedObjects);
+            }
             saveResult = exportGameState(stream, *file, packedObjects);
         }
 
@@ -906,6 +914,8 @@ namespace OpenLoco::S5
             }
 
             EntityManager::resetSpatialIndex();
+            StationManager::resetSpatialIndex();
+            Vehicles::OrderManager::importOrderTable();
             CompanyManager::updateColours();
             ObjectManager::updateTerraformObjects();
             TileManager::resetSurfaceClearance();
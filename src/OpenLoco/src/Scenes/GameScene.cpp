@@ -1,5 +1,6 @@
 #include "Scenes/GameScene.h"
 #include "Audio/Audio.h"
+#include "Benchmark.h"
 #include "Config.h"
 #include "Date.h"
 #include "Economy/Economy.h"
@@ -29,6 +30,7 @@
 #include "World/IndustryManager.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
+#include <OpenLoco/Diagnostics/Profiler.h>
 #include <OpenLoco/Utility/String.hpp>
 #include <algorithm>
 #include <cstdio>
@@ -211,32 +213,50 @@ namespace OpenLoco::Scenes::GameScene
     // 0x0046ABCB
     void tick()
     {
+        OPENLOCO_PROFILE_ZONE("GameScene::tick");
+
         if (!Network::shouldProcessTick(ScenarioManager::getScenarioTicks() + 1))
         {
             return;
         }
 
+        using Benchmark::TickStage;
+        Benchmark::beginTick();
+
         ScenarioManager::setScenarioTicks(ScenarioManager::getScenarioTicks() + 1);
         ScenarioManager::setScenarioTicks2(ScenarioManager::getScenarioTicks2() + 1);
         Network::processGameCommands(ScenarioManager::getScenarioTicks());
+        Benchmark::endStage(TickStage::network);
 
         recordTickStartPrng();
         World::TileManager::defragmentTilePeriodic();
+        Benchmark::endStage(TickStage::defragment);
 
         // Back up the `madeAnyChanges` variable to ensure we only capture user changes
         bool userMadeAnyChanges = Scenario::getOptions().madeAnyChanges;
 
         tickDate();
+        Benchmark::endStage(TickStage::date);
         World::TileManager::tick();
+        Benchmark::endStage(TickStage::tileManager);
         World::WaveManager::tick();
+        Benchmark::endStage(TickStage::waveManager);
         TownManager::tick();
+        Benchmark::endStage(TickStage::townManager);
         IndustryManager::tick();
+        Benchmark::endStage(TickStage::industryManager);
         VehicleManager::tick();
+        Benchmark::endStage(TickStage::vehicleManager);
         StationManager::tick();
+        Benchmark::endStage(TickStage::stationManager);
         EffectsManager::tick();
+        Benchmark::endStage(TickStage::effectsManager);
         CompanyManager::tick();
+        Benchmark::endStage(TickStage::companyManager);
         World::AnimationManager::tick();
+        Benchmark::endStage(TickStage::animationManager);
         Audio::tick();
+        Benchmark::endStage(TickStage::audio);
 
         Scenario::getOptions().madeAnyChanges = userMadeAnyChanges;
 
@@ -255,6 +275,8 @@ namespace OpenLoco::Scenes::GameScene
             }
             S5::resetLastLoadError();
         }
+
+        Benchmark::endTick();
     }
 
     void tickInterface()
@@ -32,6 +32,7 @@
 #include "World/CompanyManager.h"
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Diagnostics/Logging.h>
+#include <OpenLoco/Diagnostics/Profiler.h>
 #include <OpenLoco/Engine/Ui/Point.hpp>
 #include <SDL3/SDL_error.h>
 #include <SDL3/SDL_init.h>
@@ -535,12 +536,21 @@ namespace OpenLoco::Ui
             return;
         }
 
+        // The overlay shows the zones of the previous frame, so only profile while it is visible
+        // or a trace is being captured.
+        Diagnostics::Profiler::setEnabled(Config::get().showProfiler || Diagnostics::Profiler::isCapturing());
+
         if (!Intro::isActive())
         {
             drawingEngine.render();
         }
 
         drawingEngine.present();
+
+        if (Diagnostics::Profiler::isEnabled())
+        {
+            Diagnostics::Profiler::endFrame();
+        }
     }
 
     void showMessageBox(const std::string& title, const std::string& message)
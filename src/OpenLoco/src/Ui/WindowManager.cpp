@@ -28,6 +28,7 @@
 #include "World/CompanyManager.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
+#include <OpenLoco/Diagnostics/Profiler.h>
 #include <algorithm>
 #include <array>
 #include <cinttypes>
@@ -1897,6 +1898,8 @@ namespace OpenLoco::Ui::WindowManager
 
     void render(Gfx::DrawingContext& drawingCtx, const Rect& rect)
     {
+        OPENLOCO_PROFILE_ZONE("WindowManager::render");
+
         for (auto& w : _windows)
         {
             if (w.isTranslucent())
@@ -4530,8 +4530,9 @@ namespace OpenLoco::Ui::Windows::Vehicle
             uint16_t bestProgress = 0;
             auto* vpOwner = WindowManager::findWindowForViewport(&viewport);
             const auto vpOffset = vpOwner != nullptr ? vpOwner->position() : Ui::Point{};
-            for (const auto& moveInfo : moveInfoArr)
+            for (size_t i = 0; i < moveInfoArr.size(); ++i)
             {
+                const auto moveInfo = moveInfoArr[i];
                 auto potentialLoc = roadFirstTile + moveInfo.loc;
                 auto viewPos = World::gameToScreen(potentialLoc, viewport.getRotation());
                 auto uiPos = viewport.viewportToWindow(viewPos) + vpOffset;
@@ -4539,7 +4540,7 @@ namespace OpenLoco::Ui::Windows::Vehicle
                 if (distance < bestDistance)
                 {
                     bestDistance = distance;
-                    bestProgress = std::distance(&*moveInfoArr.begin(), &moveInfo);
+                    bestProgress = static_cast<uint16_t>(i);
                 }
             }
             return bestProgress;
@@ -4637,8 +4638,9 @@ namespace OpenLoco::Ui::Windows::Vehicle
             uint16_t bestProgress = 0;
             auto* vpOwner = WindowManager::findWindowForViewport(&viewport);
             const auto vpOffset = vpOwner != nullptr ? vpOwner->position() : Ui::Point{};
-            for (const auto& moveInfo : moveInfoArr)
+            for (size_t i = 0; i < moveInfoArr.size(); ++i)
             {
+                const auto moveInfo = moveInfoArr[i];
                 auto potentialLoc = trackFirstTile + moveInfo.loc;
                 auto viewPos = World::gameToScreen(potentialLoc, viewport.getRotation());
                 auto uiPos = viewport.viewportToWindow(viewPos) + vpOffset;
@@ -4646,7 +4648,7 @@ namespace OpenLoco::Ui::Windows::Vehicle
                 if (distance < bestDistance)
                 {
                     bestDistance = distance;
-                    bestProgress = std::distance(&*moveInfoArr.begin(), &moveInfo);
+                    bestProgress = static_cast<uint16_t>(i);
                 }
             }
             return bestProgress;
@@ -22,8 +22,12 @@
 #include "World/StationManager.h"
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Diagnostics/Logging.h>
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <sfl/static_vector.hpp>
 #include <sstream>
+#include <vector>
 
 using namespace OpenLoco::Diagnostics;
 
@@ -109,37 +113,157 @@ namespace OpenLoco::Vehicles::OrderManager
         return _displayFrames;
     }
 
-    Order* orders() { return reinterpret_cast<Order*>(getGameState().orders); }
+    // Order tables live in power of two sized chunks of a pool rather than back to back in the
+    // S5 order table, so editing a table only ever moves the orders of that one vehicle. The
+    // flat S5 order table is only written out on save and read back in on load.
+    static constexpr uint32_t kMinOrderChunkSize = 16;
+    static constexpr uint32_t kMaxOrderChunkSize = 512;
+    static_assert(kMaxOrderChunkSize >= Limits::kMaxOrdersPerVehicle * sizeof(OrderRouteWaypoint) + sizeof(OrderEnd));
+
+    // Every vehicle at the largest chunk size plus the chunk a table is being grown into
+    static constexpr size_t kOrderPoolSize = (Limits::kMaxVehicles + 1) * kMaxOrderChunkSize;
+
+    static std::array<uint8_t, kOrderPoolSize> _orderPool;
+    static uint32_t _orderPoolLength;
+    // Released chunks indexed by log2 of their size
+    static std::array<std::vector<uint32_t>, 32> _freeOrderChunks;
+
+    Order* orders() { return reinterpret_cast<Order*>(_orderPool.data()); }
     uint32_t& orderTableLength() { return getGameState().orderTableLength; }
 
-    void shiftOrdersLeft(const uint32_t offsetToShiftTowards, const int16_t sizeToShiftBy)
+    static uint32_t getOrderChunkSize(const uint32_t tableSize)
     {
-        std::rotate(&orders()[offsetToShiftTowards], &orders()[offsetToShiftTowards + sizeToShiftBy], &orders()[orderTableLength()]);
+        return std::bit_ceil(std::max(tableSize, kMinOrderChunkSize));
     }
 
-    void shiftOrdersRight(const uint32_t offsetToShiftFrom, const int16_t sizeToShiftBy)
+    static void offsetDisplayFrames(const uint32_t begin, const uint32_t end, const int32_t delta)
     {
-        std::rotate(&orders()[offsetToShiftFrom], &orders()[orderTableLength()], &orders()[orderTableLength() + sizeToShiftBy]);
+        for (auto& frame : _displayFrames)
+        {
+            if (frame.orderOffset >= begin && frame.orderOffset < end)
+            {
+                frame.orderOffset += delta;
+            }
+        }
     }
 
-    // 0x00470795
-    void reoffsetVehicleOrderTables(const uint32_t removeOrderTableOffset, const int16_t sizeOfRemovedOrderTable)
+    // Copies the order table of every vehicle from src to dst one after the other, each padded out
+    // to getPaddedSize(sizeOfOrderTable), and updates the vehicles and display frames to match.
+    // Tables are visited in offset order so that src and dst may be the same buffer. Nothing is
+    // modified if a table does not fit.
+    template<typename TGetPaddedSize>
+    static uint32_t relocateOrderTables(std::span<const uint8_t> src, std::span<uint8_t> dst, TGetPaddedSize&& getPaddedSize)
     {
-        for (auto head : VehicleManager::VehicleList())
+        std::vector<VehicleHead*> heads;
+        for (auto* head : VehicleManager::VehicleList())
         {
-            if (head->orderTableOffset >= removeOrderTableOffset)
+            if (head->sizeOfOrderTable != 0)
             {
-                head->orderTableOffset += sizeOfRemovedOrderTable;
+                heads.push_back(head);
             }
         }
+        std::ranges::stable_sort(heads, {}, &VehicleHead::orderTableOffset);
 
+        sfl::static_vector<uint32_t, Limits::kMaxOrdersPerVehicle> frameOffsets;
         for (auto& frame : _displayFrames)
         {
-            if (frame.orderOffset >= removeOrderTableOffset)
+            frameOffsets.push_back(frame.orderOffset);
+        }
+
+        uint32_t length = 0;
+        for (auto* head : heads)
+        {
+            const uint32_t paddedSize = getPaddedSize(head->sizeOfOrderTable);
+            if (head->orderTableOffset + head->sizeOfOrderTable > src.size() || length + paddedSize > dst.size())
+            {
+                throw Exception::RuntimeError("Bad order table");
+            }
+            length += paddedSize;
+        }
+
+        length = 0;
+        for (auto* head : heads)
+        {
+            const uint32_t paddedSize = getPaddedSize(head->sizeOfOrderTable);
+            std::memmove(&dst[length], &src[head->orderTableOffset], head->sizeOfOrderTable);
+
+            for (auto i = 0U; i < _displayFrames.size(); ++i)
+            {
+                const auto frameOffset = _displayFrames[i].orderOffset;
+                if (frameOffset >= head->orderTableOffset && frameOffset < head->orderTableOffset + head->sizeOfOrderTable)
+                {
+                    frameOffsets[i] = frameOffset - head->orderTableOffset + length;
+                }
+            }
+
+            head->orderTableOffset = length;
+            length += paddedSize;
+        }
+
+        for (auto i = 0U; i < _displayFrames.size(); ++i)
+        {
+            _displayFrames[i].orderOffset = frameOffsets[i];
+        }
+        return length;
+    }
+
+    static void compactOrderPool()
+    {
+        _orderPoolLength = relocateOrderTables(_orderPool, _orderPool, getOrderChunkSize);
+        for (auto& freeChunks : _freeOrderChunks)
+        {
+            freeChunks.clear();
+        }
+    }
+
+    // Note: may compact the pool, moving the order table of every vehicle
+    static uint32_t allocateOrderChunk(const uint32_t chunkSize)
+    {
+        auto& freeChunks = _freeOrderChunks[std::countr_zero(chunkSize)];
+        if (!freeChunks.empty())
+        {
+            const auto offset = freeChunks.back();
+            freeChunks.pop_back();
+            return offset;
+        }
+
+        if (_orderPoolLength + chunkSize > kOrderPoolSize)
+        {
+            compactOrderPool();
+            if (_orderPoolLength + chunkSize > kOrderPoolSize)
             {
-                frame.orderOffset += sizeOfRemovedOrderTable;
+                throw Exception::RuntimeError("Order pool exhausted");
             }
         }
+
+        const auto offset = _orderPoolLength;
+        _orderPoolLength += chunkSize;
+        return offset;
+    }
+
+    static void freeOrderChunk(const uint32_t offset, const uint32_t chunkSize)
+    {
+        _freeOrderChunks[std::countr_zero(chunkSize)].push_back(offset);
+    }
+
+    // Moves the order table into a chunk of the right size when newSize falls in another size class.
+    // Only the first min(sizeOfOrderTable, newSize) bytes are carried over.
+    static void resizeOrderChunk(VehicleHead& head, const uint16_t newSize)
+    {
+        const auto oldChunkSize = getOrderChunkSize(head.sizeOfOrderTable);
+        const auto newChunkSize = getOrderChunkSize(newSize);
+        if (oldChunkSize == newChunkSize)
+        {
+            return;
+        }
+
+        const auto newOffset = allocateOrderChunk(newChunkSize);
+        const auto oldOffset = head.orderTableOffset;
+        std::memcpy(&_orderPool[newOffset], &_orderPool[oldOffset], std::min(head.sizeOfOrderTable, newSize));
+        freeOrderChunk(oldOffset, oldChunkSize);
+
+        offsetDisplayFrames(oldOffset, oldOffset + head.sizeOfOrderTable, static_cast<int32_t>(newOffset - oldOffset));
+        head.orderTableOffset = newOffset;
     }
 
     bool spaceLeftInGlobalOrderTableForOrder(const Order* order)
@@ -168,20 +292,20 @@ namespace OpenLoco::Vehicles::OrderManager
             head->currentOrder += insOrderLength;
         }
 
-        head->sizeOfOrderTable += insOrderLength;
+        // Make room for the new order within this vehicle's table
+        const auto oldSize = head->sizeOfOrderTable;
+        resizeOrderChunk(*head, oldSize + insOrderLength);
+        auto* table = reinterpret_cast<uint8_t*>(orders() + head->orderTableOffset);
+        std::memmove(table + orderOffset + insOrderLength, table + orderOffset, oldSize - orderOffset);
+        offsetDisplayFrames(head->orderTableOffset + 1, head->orderTableOffset + oldSize, insOrderLength);
 
-        // Shift existing orders to make room for the new one
-        shiftOrdersRight(head->orderTableOffset + orderOffset, insOrderLength);
+        head->sizeOfOrderTable += insOrderLength;
         // Bookkeeping: change order table size
         orderTableLength() += insOrderLength;
 
-        // Calculate destination offset and copy data
+        // Copy the new order data into place
         auto rawOrder = order->getRaw();
-        auto dest = reinterpret_cast<uint8_t*>(orders() + head->orderTableOffset + orderOffset);
-        std::memcpy(dest, &rawOrder, insOrderLength);
-
-        // Recalculate order offsets for other vehicles
-        reoffsetVehicleOrderTables(head->orderTableOffset + 1, insOrderLength);
+        std::memcpy(table + orderOffset, &rawOrder, insOrderLength);
     }
 
     // 0x004705C0
@@ -193,6 +317,14 @@ namespace OpenLoco::Vehicles::OrderManager
         auto& selectedOrder = *(orders.begin());
 
         auto removeOrderSize = kOrderSizes[enumValue(selectedOrder.getType())];
+
+        // Move the remaining orders of this vehicle over the removed order
+        const auto oldSize = head->sizeOfOrderTable;
+        auto* table = reinterpret_cast<uint8_t*>(&selectedOrder) - orderOffset;
+        std::memmove(table + orderOffset, table + orderOffset + removeOrderSize, oldSize - orderOffset - removeOrderSize);
+        offsetDisplayFrames(head->orderTableOffset + orderOffset + 1, head->orderTableOffset + oldSize, -removeOrderSize);
+        resizeOrderChunk(*head, oldSize - removeOrderSize);
+
         head->sizeOfOrderTable -= removeOrderSize;
 
         // Are we removing an order that appears before the current order? Move back a bit
@@ -207,14 +339,8 @@ namespace OpenLoco::Vehicles::OrderManager
             head->currentOrder = 0;
         }
 
-        // Move orders in the order table, effectively removing the order
-        shiftOrdersLeft(head->orderTableOffset + orderOffset, removeOrderSize);
-
         // Bookkeeping: change order table size
         orderTableLength() -= removeOrderSize;
-
-        // Compensate other vehicles to use new table offsets
-        reoffsetVehicleOrderTables(head->orderTableOffset + orderOffset + 1, -removeOrderSize);
     }
 
     // 0x004702F7
@@ -224,27 +350,60 @@ namespace OpenLoco::Vehicles::OrderManager
         std::fill(std::begin(getGameState().orders) + orderTableLength(), std::end(getGameState().orders), 0);
     }
 
+    // Writes the order tables out back to back into the S5 order table, pointing the vehicles
+    // at their offsets within it. importOrderTable must be called before touching orders again.
+    void exportOrderTable()
+    {
+        orderTableLength() = relocateOrderTables(_orderPool, getGameState().orders, [](const uint32_t tableSize) { return tableSize; });
+    }
+
+    // Rebuilds the pooled order tables from the S5 order table
+    void importOrderTable()
+    {
+        for (auto& freeChunks : _freeOrderChunks)
+        {
+            freeChunks.clear();
+        }
+        _orderPoolLength = relocateOrderTables(getGameState().orders, _orderPool, getOrderChunkSize);
+    }
+
+    ScopedOrderTableExport::ScopedOrderTableExport()
+    {
+        exportOrderTable();
+    }
+
+    ScopedOrderTableExport::~ScopedOrderTableExport()
+    {
+        try
+        {
+            importOrderTable();
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to restore the order tables: {}", e.what());
+        }
+    }
+
     // 0x004702EC
     void reset()
     {
         // No need to zero order table as it will get cleaned up on save
         orderTableLength() = 0;
+        _orderPoolLength = 0;
+        for (auto& freeChunks : _freeOrderChunks)
+        {
+            freeChunks.clear();
+        }
     }
 
     // 0x00470334
     // Remove vehicle ?orders?
     void freeOrders(VehicleHead* const head)
     {
-        // Copy the offset as it will get modified during sub_470795
-        const auto offset = head->orderTableOffset;
-        const auto size = head->sizeOfOrderTable;
-
-        reoffsetVehicleOrderTables(offset, -size);
-
-        // Shift orders table left to remove empty orders
-        shiftOrdersLeft(offset, size);
+        freeOrderChunk(head->orderTableOffset, getOrderChunkSize(head->sizeOfOrderTable));
 
         orderTableLength() -= head->sizeOfOrderTable;
+        head->sizeOfOrderTable = 0;
     }
 
     // 0x00470312
@@ -253,7 +412,9 @@ namespace OpenLoco::Vehicles::OrderManager
         OrderEnd end{};
         constexpr auto insOrderLength = kOrderSizes[enumValue(OrderEnd::kType)];
 
-        head.orderTableOffset = orderTableLength();
+        // Not yet holding a chunk should the allocation compact the pool
+        head.sizeOfOrderTable = 0;
+        head.orderTableOffset = allocateOrderChunk(getOrderChunkSize(insOrderLength));
         // Bookkeeping: change order table size
         orderTableLength() += insOrderLength;
 
@@ -502,27 +663,20 @@ namespace OpenLoco::Vehicles::OrderManager
     // 0x0047062B
     void removeOrdersForStation(const StationId stationId)
     {
-        for (auto i = 0U; i < orderTableLength();)
+        for (auto* head : VehicleManager::VehicleList())
         {
-            auto& order = orders()[i];
-            auto* stationOrder = order.as<OrderStation>();
-            if (stationOrder != nullptr)
+            for (auto offset = 0U; offset < head->sizeOfOrderTable;)
             {
-                if (stationOrder->getStation() == stationId)
+                auto* order = orders() + head->orderTableOffset + offset;
+                auto* stationOrder = order->as<OrderStation>();
+                if (stationOrder != nullptr && stationOrder->getStation() == stationId)
                 {
-                    // Find the vehicle that has the order
-                    for (auto* head : VehicleManager::VehicleList())
-                    {
-                        if (head->orderTableOffset <= i
-                            && i < head->orderTableOffset + head->sizeOfOrderTable)
-                        {
-                            deleteOrder(head, i - head->orderTableOffset);
-                            break;
-                        }
-                    }
+                    deleteOrder(head, offset);
+                    // The order that moved into the removed order's place is skipped, as in vanilla
+                    order = orders() + head->orderTableOffset + offset;
                 }
+                offset += kOrderSizes[enumValue(order->getType())];
             }
-            i += kOrderSizes[enumValue(order.getType())];
         }
     }
 }
@@ -20,7 +20,11 @@
 #include "ViewportManager.h"
 #include "World/CompanyManager.h"
 #include <OpenLoco/Engine/World.hpp>
+#include <algorithm>
 #include <sfl/static_vector.hpp>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
 
 namespace OpenLoco::Vehicles
 {
@@ -420,10 +424,28 @@ namespace OpenLoco::Vehicles
         }
     }
 
+    // A track location and direction that a vehicle found on tile must be on to occupy a signal block
+    struct OccupancyProbe
+    {
+        World::Pos2 tile;
+        World::Pos3 trackLoc;
+        TrackAndDirection::_TrackAndDirection tad;
+    };
+
+    // The track pieces reachable from a starting piece without passing a signal. Only depends on the
+    // track network so it is kept until the network changes instead of flood filling on every query.
+    struct SignalBlock
+    {
+        // In the iteration order of the routing results the block was built from
+        std::vector<LocationOfInterest> signals;
+        // Sorted by tile so each tile's entity list is only walked once
+        std::vector<OccupancyProbe> probes;
+    };
+
     // 0x004A2AF0
-    // Passes occupied state via _routingTransformData
+    // Collects the locations at which a vehicle occupies the track piece of interest
     // Returns true for signal block end
-    static bool findOccupationByBlock(const LocationOfInterest& interest, uint16_t& routingTransformData)
+    static bool addOccupancyProbes(const LocationOfInterest& interest, std::vector<OccupancyProbe>& probes)
     {
         auto nextLoc = interest.loc;
         const auto tad = interest.tad();
@@ -443,7 +465,25 @@ namespace OpenLoco::Vehicles
             const auto rotPos = Math::Vector::rotate(Pos2{ trackPiece.x, trackPiece.y }, tad.cardinalDirection());
             const auto trackLoc = Pos2{ startLoc } + rotPos;
 
-            for (auto* entity : EntityManager::EntityTileList(trackLoc))
+            probes.push_back(OccupancyProbe{ trackLoc, interest.loc, tad });
+            probes.push_back(OccupancyProbe{ trackLoc, nextLoc, backwardTaD });
+        }
+        return interest.trackAndDirection & World::Track::AdditionalTaDFlags::hasSignal;
+    }
+
+    static bool isSignalBlockOccupied(const SignalBlock& block)
+    {
+        const auto& probes = block.probes;
+        for (size_t first = 0; first < probes.size();)
+        {
+            const auto tile = probes[first].tile;
+            auto last = first + 1;
+            while (last < probes.size() && probes[last].tile == tile)
+            {
+                last++;
+            }
+
+            for (auto* entity : EntityManager::EntityTileList(tile))
             {
                 auto* vehicle = entity->asBase<Vehicles::VehicleBase>();
                 if (vehicle == nullptr)
@@ -456,36 +496,19 @@ namespace OpenLoco::Vehicles
                     continue;
                 }
 
-                if (vehicle->getTrackLoc() == interest.loc && vehicle->getTrackAndDirection().track == tad)
+                const auto trackLoc = vehicle->getTrackLoc();
+                const auto tad = vehicle->getTrackAndDirection().track;
+                for (auto i = first; i < last; ++i)
                 {
-                    routingTransformData = 1;
-                    break;
-                }
-
-                if (vehicle->getTrackLoc() == nextLoc && vehicle->getTrackAndDirection().track == backwardTaD)
-                {
-                    routingTransformData = 1;
-                    break;
+                    if (probes[i].trackLoc == trackLoc && probes[i].tad == tad)
+                    {
+                        return true;
+                    }
                 }
             }
+            first = last;
         }
-        return interest.trackAndDirection & World::Track::AdditionalTaDFlags::hasSignal;
-    }
-
-    // 0x004A2CE7
-    static void setSignalsOccupiedState(const RoutingResults& results, const uint16_t& routingTransformData)
-    {
-        for (const auto& interest : results.reachableLocs)
-        {
-            if (!(interest.trackAndDirection & World::Track::AdditionalTaDFlags::hasSignal))
-            {
-                continue;
-            }
-
-            bool isOccupied = routingTransformData & 1;
-            uint32_t flags = (1ULL << 31) | (isOccupied ? 8ULL : 9ULL);
-            setSignalState(interest.loc, interest.tad(), interest.trackType, flags);
-        }
+        return false;
     }
 
     // 0x004A2D4C
@@ -858,36 +881,56 @@ namespace OpenLoco::Vehicles
         transformFunction(results);
     }
 
-    // 0x004A2AD7
-    void sub_4A2AD7(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType)
+    struct SignalBlockKey
     {
-        // 0x001135F88
-        uint16_t routingTransformData = 0;
+        World::Pos3 loc;
+        uint16_t trackAndDirection;
+        CompanyId company;
+        uint8_t trackType;
 
-        auto filterFunction = [&routingTransformData](const LocationOfInterest& interest) { return findOccupationByBlock(interest, routingTransformData); };
-        auto transformFunction = [&routingTransformData](const RoutingResults& results) { setSignalsOccupiedState(results, routingTransformData); };
-        RoutingResults interestMap{ kSignalHashSetSize };
+        bool operator==(const SignalBlockKey&) const = default;
+    };
 
-        findAllTracksFilterTransform(
-            interestMap,
-            TrackNetworkSearchFlags::unk2,
-            loc,
-            trackAndDirection,
-            company,
-            trackType,
-            filterFunction,
-            transformFunction);
-    }
+    struct SignalBlockKeyHash
+    {
+        size_t operator()(const SignalBlockKey& key) const
+        {
+            const uint64_t pos = (static_cast<uint64_t>(static_cast<uint16_t>(key.loc.x)) << 32)
+                | (static_cast<uint64_t>(static_cast<uint16_t>(key.loc.y)) << 16)
+                | static_cast<uint16_t>(key.loc.z);
+            const uint64_t query = (static_cast<uint64_t>(key.trackAndDirection) << 16)
+                | (static_cast<uint64_t>(enumValue(key.company)) << 8)
+                | key.trackType;
+            return std::hash<uint64_t>{}(pos ^ (query * 0x9E3779B97F4A7C15ULL));
+        }
+    };
 
-    // 0x004A2A39
-    bool isBlockOccupied(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType)
+    // Bounds the memory used on very large networks, the cache simply starts over
+    constexpr size_t kMaxCachedSignalBlocks = 1U << 12;
+
+    static std::unordered_map<SignalBlockKey, SignalBlock, SignalBlockKeyHash> _signalBlocks;
+    static uint32_t _signalBlocksRevision = 0;
+
+    // The returned block is only valid until the next call
+    static const SignalBlock& getSignalBlock(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType)
     {
-        // 0x001135F88
-        uint16_t routingTransformData = 0;
+        const auto revision = World::Track::getTrackNetworkRevision();
+        if (revision != _signalBlocksRevision || _signalBlocks.size() >= kMaxCachedSignalBlocks)
+        {
+            _signalBlocks.clear();
+            _signalBlocksRevision = revision;
+        }
 
-        auto filterFunction = [&routingTransformData](const LocationOfInterest& interest) { return findOccupationByBlock(interest, routingTransformData); };
+        const SignalBlockKey key{ loc, trackAndDirection._data, company, trackType };
+        auto it = _signalBlocks.find(key);
+        if (it != _signalBlocks.end())
+        {
+            return it->second;
+        }
 
+        SignalBlock block;
         RoutingResults interestMap{ kSignalHashSetSize };
+        auto filterFunction = [&block](const LocationOfInterest& interest) { return addOccupancyProbes(interest, block.probes); };
 
         findAllTracksFilterTransform(
             interestMap,
@@ -897,38 +940,48 @@ namespace OpenLoco::Vehicles
             company,
             trackType,
             filterFunction,
-            [](RoutingResults&) {});
-        return routingTransformData & 1;
+            kNullTransformFunction);
+
+        for (const auto& interest : interestMap.reachableLocs)
+        {
+            if (interest.trackAndDirection & World::Track::AdditionalTaDFlags::hasSignal)
+            {
+                block.signals.push_back(interest);
+            }
+        }
+        std::stable_sort(block.probes.begin(), block.probes.end(), [](const OccupancyProbe& lhs, const OccupancyProbe& rhs) {
+            return std::tie(lhs.tile.x, lhs.tile.y) < std::tie(rhs.tile.x, rhs.tile.y);
+        });
+
+        return _signalBlocks.emplace(key, std::move(block)).first->second;
     }
 
-    // 0x004AC217
-    // Passes occupied state via _routingTransformData
-    // Returns true for signal block end
-    static bool setReverseSignalOccupied(const LocationOfInterest& interest)
+    // 0x004A2AD7
+    void sub_4A2AD7(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType)
     {
-        if (!(interest.trackAndDirection & World::Track::AdditionalTaDFlags::hasSignal))
+        const auto& block = getSignalBlock(loc, trackAndDirection, company, trackType);
+
+        // 0x004A2CE7
+        const bool isOccupied = isSignalBlockOccupied(block);
+        const uint32_t flags = (1ULL << 31) | (isOccupied ? 8ULL : 9ULL);
+        for (const auto& interest : block.signals)
         {
-            return false;
+            setSignalState(interest.loc, interest.tad(), interest.trackType, flags);
         }
+    }
 
-        setSignalState(interest.loc, interest.tad(), interest.trackType, (1ULL << 31) | (8));
-
-        return true;
+    // 0x004A2A39
+    bool isBlockOccupied(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType)
+    {
+        return isSignalBlockOccupied(getSignalBlock(loc, trackAndDirection, company, trackType));
     }
 
     void setReverseSignalOccupiedInBlock(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType)
     {
-        RoutingResults interestMap{ kSignalHashSetSize };
-
-        findAllTracksFilterTransform(
-            interestMap,
-            TrackNetworkSearchFlags::unk2,
-            loc,
-            trackAndDirection,
-            company,
-            trackType,
-            setReverseSignalOccupied,
-            [](RoutingResults&) {});
+        for (const auto& interest : getSignalBlock(loc, trackAndDirection, company, trackType).signals)
+        {
+            setSignalState(interest.loc, interest.tad(), interest.trackType, (1ULL << 31) | (8));
+        }
     }
 
     // 0x004A2A58
@@ -936,19 +989,10 @@ namespace OpenLoco::Vehicles
     {
         // 0x001135F88
         uint16_t unk = 0;
-        RoutingResults interestMap{ kSignalHashSetSize };
-        auto filterFunction = [&unk](const LocationOfInterest& interest) { return sub_4A2D4C(interest, unk); };
-
-        findAllTracksFilterTransform(
-            interestMap,
-            TrackNetworkSearchFlags::unk2,
-            loc,
-            trackAndDirection,
-            company,
-            trackType,
-            filterFunction,
-            kNullTransformFunction);
-
+        for (const auto& interest : getSignalBlock(loc, trackAndDirection, company, trackType).signals)
+        {
+            sub_4A2D4C(interest, unk);
+        }
         return unk;
     }
 
@@ -1143,6 +1187,7 @@ namespace OpenLoco::Vehicles
                                 elTrack->setMod(i, true);
                             }
                         }
+                        invalidateTrackNetwork();
                         invalidate = true;
                     }
                     if (invalidate)
@@ -1281,6 +1326,7 @@ namespace OpenLoco::Vehicles
                             elTrack->setMod(i, false);
                         }
                     }
+                    invalidateTrackNetwork();
                     invalidate = true;
                 }
                 if (invalidate)
@@ -1485,6 +1531,7 @@ namespace OpenLoco::Vehicles
                                 elRoad->setMod(i, true);
                             }
                         }
+                        invalidateTrackNetwork();
                         invalidate = true;
                     }
                     if (invalidate)
@@ -1647,6 +1694,7 @@ namespace OpenLoco::Vehicles
                             elRoad->setMod(i, false);
                         }
                     }
+                    invalidateTrackNetwork();
                     invalidate = true;
                 }
                 if (invalidate)
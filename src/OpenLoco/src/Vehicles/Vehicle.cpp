@@ -387,58 +387,65 @@ namespace OpenLoco::Vehicles
         for (const auto& nearby : kMooreNeighbourhood)
         {
             const auto inspectionPos = World::toTileSpace(loc) + nearby;
-            for (auto* entity : EntityManager::EntityTileList(World::toWorldSpace(inspectionPos)))
-            {
-                auto* vehicleBase = entity->asBase<VehicleBase>();
-                if (vehicleBase == nullptr || vehicleBase == &bogie)
+            auto collision = EntityId::null;
+            EntityManager::forEachEntityOnTile(inspectionPos, [&](EntityId id, const World::Pos3& position) {
+                // Position checks first as they only read the packed spatial index
+                const auto zDiff = std::abs(loc.z - position.z);
+                if (zDiff > 16)
                 {
-                    continue;
+                    return true;
                 }
-                if (vehicleBase->getTransportMode() != TransportMode::rail)
+
+                // vanilla did some overflow checks here but since we promote to int it shouldn't be needed
+                const auto distance = Math::Vector::manhattanDistance2D(position, loc);
+                if (distance >= 12)
                 {
-                    continue;
+                    return true;
                 }
 
-                const auto zDiff = std::abs(loc.z - vehicleBase->position.z);
-                if (zDiff > 16)
+                auto* vehicleBase = EntityManager::get<VehicleBase>(id);
+                if (vehicleBase == nullptr || vehicleBase == &bogie)
                 {
-                    continue;
+                    return true;
                 }
-
-                // vanilla did some overflow checks here but since we promote to int it shouldn't be needed
-                const auto distance = Math::Vector::manhattanDistance2D(vehicleBase->position, loc);
-                if (distance >= 12)
+                if (vehicleBase->getTransportMode() != TransportMode::rail)
                 {
-                    continue;
+                    return true;
                 }
 
                 const auto subType = vehicleBase->getSubType();
                 // Does it actually have a collidable body
                 if (subType != VehicleEntityType::body_continued && subType != VehicleEntityType::body_start && subType != VehicleEntityType::bogie)
                 {
-                    continue;
+                    return true;
                 }
 
                 if (vehicleBase->owner != bogie.owner)
                 {
-                    continue;
+                    return true;
                 }
 
                 // This is an optimisation compared to vanilla
                 if (vehicleBase->getHead() != bogie.head)
                 {
-                    return vehicleBase->id;
+                    collision = vehicleBase->id;
+                    return false;
                 }
 
                 if (ignoreSelfCollision(bogie, *vehicleBase))
                 {
-                    continue;
+                    return true;
                 }
                 if (ignoreSelfCollision(*vehicleBase, bogie))
                 {
-                    continue;
+                    return true;
                 }
-                return vehicleBase->id;
+                collision = vehicleBase->id;
+                return false;
+            });
+            if (collision != EntityId::null)
+            {
+                return collision;
             }
         }
         return EntityId::null;
@@ -473,7 +480,7 @@ namespace OpenLoco::Vehicles
             }
             // 0x0047C95B
             component.subPosition = newSubPosition;
-            const auto& moveData = World::TrackData::getRoadSubPositon(component.trackAndDirection.road._data)[newSubPosition];
+            const auto moveData = World::TrackData::getRoadSubPositon(component.trackAndDirection.road._data)[newSubPosition];
             const auto nextNewPosition = moveData.loc + World::Pos3(component.tileX, component.tileY, component.tileBaseZ * World::kSmallZStep);
             component.remainingDistance -= kMovementNibbleToDistance[getMovementNibble(intermediatePosition, nextNewPosition)];
             intermediatePosition = nextNewPosition;
@@ -531,7 +538,7 @@ namespace OpenLoco::Vehicles
                 }
                 // 0x004B1761
                 component.subPosition = newSubPosition;
-                const auto& moveData = World::TrackData::getTrackSubPositon(component.trackAndDirection.track._data)[newSubPosition];
+                const auto moveData = World::TrackData::getTrackSubPositon(component.trackAndDirection.track._data)[newSubPosition];
                 const auto nextNewPosition = moveData.loc + World::Pos3(component.tileX, component.tileY, component.tileBaseZ * World::kSmallZStep);
                 component.remainingDistance -= kMovementNibbleToDistance[getMovementNibble(intermediatePosition, nextNewPosition)];
                 intermediatePosition = nextNewPosition;
@@ -46,6 +46,7 @@
 #include "Vehicles/VehicleBogie.h"
 #include "Vehicles/VehicleManager.h"
 #include "Vehicles/VehicleTail.h"
+#include "Vehicles/WaterPathfinding.h"
 #include "ViewportManager.h"
 #include "World/CompanyManager.h"
 #include "World/CompanyRecords.h"
@@ -55,9 +56,14 @@
 
 #include <OpenLoco/Math/Bound.hpp>
 #include <OpenLoco/Math/Trigonometry.hpp>
+#include <algorithm>
 #include <cassert>
 #include <numeric>
 #include <optional>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
 
 using namespace OpenLoco::Literals;
 using namespace OpenLoco::World;
@@ -3643,12 +3649,6 @@ namespace OpenLoco::Vehicles
         }
     }
 
-    struct NearbyBoats
-    {
-        std::array<std::array<bool, 16>, 16> searchResult; // 0x00525BEC
-        World::TilePos2 startTile;                         // 0x00525BE8
-    };
-
     // 0x00427F1C
     static NearbyBoats findNearbyTilesWithBoats(const World::Pos2 pos)
     {
@@ -3736,79 +3736,6 @@ namespace OpenLoco::Vehicles
         return std::nullopt;
     }
 
-    struct PathFindingResult
-    {
-        uint16_t bestScore;
-        uint8_t cost;
-
-        constexpr auto operator<=>(const PathFindingResult& rhs) const = default;
-    };
-
-    // 0x00428237
-    static PathFindingResult waterPathfindToTarget(const World::TilePos2 tilePos, const MicroZ waterMicroZ, const World::TilePos2 targetOrderPos, const NearbyBoats& nearbyVehicles, uint8_t cost, const PathFindingResult& bestResult)
-    {
-        PathFindingResult result = bestResult;
-        if (!validCoords(tilePos))
-        {
-            return result;
-        }
-
-        auto tile = TileManager::get(tilePos);
-        auto* surfaceEntry = tile.surfaceEntry();
-        if (surfaceEntry == nullptr)
-        {
-            return result;
-        }
-
-        auto* surfaceEl = surfaceEntry->as<SurfaceElement>();
-        if (surfaceEl != nullptr && surfaceEl->water() != waterMicroZ)
-        {
-            return result;
-        }
-        if (!surfaceEntry->isLast())
-        {
-            auto* elObsticle = surfaceEntry->next();
-            if (elObsticle != nullptr && !elObsticle->isGhost() && !elObsticle->isAiAllocated())
-            {
-                if (elObsticle->baseZ() / kMicroToSmallZStep - waterMicroZ < 1)
-                {
-                    return result;
-                }
-            }
-        }
-
-        const auto nearbyIndex = tilePos - nearbyVehicles.startTile;
-        // Vanilla made a mistake here so we only check nearby tiles if in range
-        // TODO: When we diverge just change the cost check to >= 6 or increase the search result to 18x18
-        if (nearbyIndex.x >= 0 && nearbyIndex.x < 16 && nearbyIndex.y >= 0 && nearbyIndex.y < 16)
-        {
-            if (nearbyVehicles.searchResult[nearbyIndex.x][nearbyIndex.y])
-            {
-                return result;
-            }
-        }
-        auto distToTarget = toWorldSpace(tilePos - targetOrderPos);
-        distToTarget.x = std::abs(distToTarget.x);
-        distToTarget.y = std::abs(distToTarget.y);
-        // Lower is better
-        const uint16_t score = std::max(distToTarget.x, distToTarget.y) + std::min(distToTarget.x, distToTarget.y) / 16;
-        auto newResult = PathFindingResult{ score, cost };
-        result = std::min(result, newResult);
-        if (score != 0)
-        {
-            if (cost >= 7)
-            {
-                return result;
-            }
-            cost++;
-            for (auto i = 0U; i < 4; ++i)
-            {
-                result = waterPathfindToTarget(tilePos + toTileSpace(kRotationOffset[i]), waterMicroZ, targetOrderPos, nearbyVehicles, cost, result);
-            }
-        }
-        return result;
-    }
-
     // 0x00427FC9
     static WaterPathingResult waterPathfind(const VehicleHead& head)
     {
@@ -3853,13 +3780,14 @@ namespace OpenLoco::Vehicles
         const auto initialTile = toTileSpace(head.position);
         const auto waterMicroZ = veh2.position.z / World::kMicroZStep;
 
+        WaterPassabilityCache passability(initialTile, waterMicroZ, nearbyVehicles);
         PathFindingResult bestResult{ std::numeric_limits<uint16_t>::max(), std::numeric_limits<uint8_t>::max() };
         uint8_t bestResultDirection = 0xFFU;
         for (auto i = 0U; i < 4; ++i)
         {
             const auto tilePos = initialTile + toTileSpace(kRotationOffset[i]);
             PathFindingResult initResult{ std::numeric_limits<uint16_t>::max(), std::numeric_limits<uint8_t>::max() };
-            const auto pathResult = waterPathfindToTarget(tilePos, waterMicroZ, targetOrderPos, nearbyVehicles, 0, initResult);
+            const auto pathResult = waterPathfindToTarget(tilePos, targetOrderPos, passability);
             if (pathResult != initResult && (pathResult < bestResult || (pathResult == bestResult && i == curRotation)))
             {
                 bestResult = pathResult;
@@ -5240,6 +5168,314 @@ namespace OpenLoco::Vehicles
         return state.result;
     }
 
+    // Optional A* road pathing (Config::roadAStarPathing)
+    //
+    // Roads are searched on a junction graph whose edges are the chains of road pieces that only
+    // have a single onward connection. Chains are discovered lazily and live until the next track
+    // network revision, which is bumped whenever track, road, signal or station elements change and
+    // whenever tile elements are reorganised.
+
+    struct RoadGraphPiece
+    {
+        World::Pos3 pos;
+        uint16_t tad;
+        StationId stationId;
+        uint8_t stationObjectId;
+    };
+
+    struct RoadGraphChain
+    {
+        // The first piece is the chain start, the station of it is given by the piece that led to it
+        std::vector<RoadGraphPiece> pieces;
+        sfl::static_vector<RoadGraphPiece, 16> successors;
+    };
+
+    struct RoadGraphKey
+    {
+        World::Pos3 pos;
+        uint16_t tad;
+        CompanyId companyId;
+        uint8_t roadObjectId;
+        uint8_t requiredMods;
+        uint8_t queryMods;
+
+        bool operator==(const RoadGraphKey&) const = default;
+    };
+
+    struct RoadGraphKeyHash
+    {
+        size_t operator()(const RoadGraphKey& key) const
+        {
+            const uint64_t pos = (static_cast<uint64_t>(static_cast<uint16_t>(key.pos.x)) << 32)
+                | (static_cast<uint64_t>(static_cast<uint16_t>(key.pos.y)) << 16)
+                | static_cast<uint16_t>(key.pos.z);
+            const uint64_t query = (static_cast<uint64_t>(key.tad) << 32)
+                | (static_cast<uint64_t>(enumValue(key.companyId)) << 24)
+                | (static_cast<uint64_t>(key.roadObjectId) << 16)
+                | (static_cast<uint64_t>(key.requiredMods) << 8)
+                | key.queryMods;
+            return std::hash<uint64_t>{}(pos ^ (query * 0x9E3779B97F4A7C15ULL));
+        }
+    };
+
+    // Splits chains around loops without junctions
+    constexpr size_t kMaxRoadChainPieces = 64;
+    // Bounds the memory used on very large networks, the caches simply start over
+    constexpr size_t kMaxCachedRoadChains = 1U << 14;
+    constexpr size_t kMaxCachedRoadRoutes = 1U << 12;
+    // Searches give up past roughly 16 times the reach of the vanilla depth limited search
+    constexpr uint32_t kMaxRoadSearchWeighting = 1280 * 16;
+    constexpr size_t kMaxRoadSearchChains = 4096;
+
+    static std::unordered_map<RoadGraphKey, RoadGraphChain, RoadGraphKeyHash> _roadGraph;
+    static uint32_t _roadGraphRevision = 0;
+
+    static const RoadGraphChain& getRoadGraphChain(const RoadGraphKey& key)
+    {
+        auto it = _roadGraph.find(key);
+        if (it != _roadGraph.end())
+        {
+            return it->second;
+        }
+
+        RoadGraphChain chain;
+        RoadGraphPiece cur{ key.pos, key.tad, StationId::null, 0 };
+        for (;;)
+        {
+            chain.pieces.push_back(cur);
+
+            const auto [nextPos, nextRotation] = Track::getRoadConnectionEnd(cur.pos, cur.tad & World::Track::AdditionalTaDFlags::basicRaDMask);
+            const auto rc = World::Track::getRoadConnectionsOneWay(nextPos, nextRotation, key.companyId, key.roadObjectId, key.requiredMods, key.queryMods);
+            const auto toPiece = [&](const uint16_t connection) {
+                return RoadGraphPiece{ nextPos, static_cast<uint16_t>(connection & 0x807FU), rc.stationId, rc.stationObjectId };
+            };
+
+            if (rc.connections.size() != 1 || chain.pieces.size() >= kMaxRoadChainPieces)
+            {
+                for (const auto connection : rc.connections)
+                {
+                    chain.successors.push_back(toPiece(connection));
+                }
+                break;
+            }
+            cur = toPiece(rc.connections.front());
+        }
+        return _roadGraph.emplace(key, std::move(chain)).first->second;
+    }
+
+    enum class RoadTargetState : uint8_t
+    {
+        notTarget,
+        free,
+        occupied,
+    };
+
+    // Same conditions as roadTargetedPathingRecurse uses to decide it has reached the target
+    static RoadTargetState getRoadTargetState(const RoadGraphPiece& piece, const uint32_t allowedStationTypes, const Sub4AC94FTarget& target)
+    {
+        TrackAndDirection::_RoadAndDirection tad{ 0, 0 };
+        tad._data = piece.tad;
+        if (target.stationId == StationId::null)
+        {
+            if ((piece.pos == target.pos && tad.basicRad() == target.tad)
+                || (piece.pos == target.reversePos && tad.basicRad() == target.reverseTad))
+            {
+                return RoadTargetState::free;
+            }
+            return RoadTargetState::notTarget;
+        }
+
+        if (piece.stationId != target.stationId || !(allowedStationTypes & (1U << piece.stationObjectId)))
+        {
+            return RoadTargetState::notTarget;
+        }
+        const auto forwardRes = getRoadOccupation(piece.pos, tad);
+        if ((forwardRes & RoadOccupationFlags::hasStation) == RoadOccupationFlags::none)
+        {
+            return RoadTargetState::notTarget;
+        }
+        if ((forwardRes & RoadOccupationFlags::isLaneOccupied) == RoadOccupationFlags::none)
+        {
+            return RoadTargetState::free;
+        }
+        auto reverseTad = tad;
+        reverseTad.setReversed(!reverseTad.isReversed());
+        const auto backwardRes = getRoadOccupation(piece.pos, reverseTad);
+        if ((backwardRes & RoadOccupationFlags::isLaneOccupied) == RoadOccupationFlags::none)
+        {
+            return RoadTargetState::free;
+        }
+        return RoadTargetState::occupied;
+    }
+
+    struct RoadRoute
+    {
+        std::optional<uint32_t> weighting;
+        RoadGraphPiece reached;
+        // Station pieces passed over as occupied before the route was found, the route
+        // only stays the cheapest while these remain occupied and the reached piece free
+        std::vector<RoadGraphPiece> occupied;
+    };
+
+    struct RoadRouteKey
+    {
+        RoadGraphKey start;
+        StationId stationId;
+        uint32_t allowedStationTypes;
+        World::Pos3 targetPos;
+        uint16_t targetTad;
+
+        bool operator==(const RoadRouteKey&) const = default;
+    };
+
+    struct RoadRouteKeyHash
+    {
+        size_t operator()(const RoadRouteKey& key) const
+        {
+            const uint64_t pos = (static_cast<uint64_t>(static_cast<uint16_t>(key.targetPos.x)) << 32)
+                | (static_cast<uint64_t>(static_cast<uint16_t>(key.targetPos.y)) << 16)
+                | static_cast<uint16_t>(key.targetPos.z);
+            const uint64_t query = (static_cast<uint64_t>(enumValue(key.stationId)) << 48)
+                | (static_cast<uint64_t>(key.targetTad) << 32)
+                | key.allowedStationTypes;
+            return RoadGraphKeyHash{}(key.start) ^ std::hash<uint64_t>{}(pos ^ (query * 0x9E3779B97F4A7C15ULL));
+        }
+    };
+
+    static std::unordered_map<RoadRouteKey, RoadRoute, RoadRouteKeyHash> _roadRoutes;
+
+    static bool isRoadRouteStillValid(const RoadRoute& route, const uint32_t allowedStationTypes, const Sub4AC94FTarget& target)
+    {
+        if (route.weighting && getRoadTargetState(route.reached, allowedStationTypes, target) != RoadTargetState::free)
+        {
+            return false;
+        }
+        return std::ranges::all_of(route.occupied, [&](const RoadGraphPiece& piece) {
+            return getRoadTargetState(piece, allowedStationTypes, target) == RoadTargetState::occupied;
+        });
+    }
+
+    static RoadRoute findRoadRoute(const RoadGraphKey& start, const uint32_t allowedStationTypes, const Sub4AC94FTarget& target)
+    {
+        struct OpenChain
+        {
+            uint32_t estimate;
+            uint32_t weighting;
+            uint32_t order;
+            RoadGraphPiece piece;
+
+            // Ordered for a min heap, ties broken by insertion order to keep results deterministic
+            bool operator<(const OpenChain& rhs) const
+            {
+                return std::tie(estimate, order) > std::tie(rhs.estimate, rhs.order);
+            }
+        };
+
+        // Roughly the least weighting per unit of distance covered by any road piece
+        const auto heuristic = [&target](const World::Pos3& pos) {
+            return static_cast<uint32_t>(Math::Vector::manhattanDistance2D(pos, target.pos) * 3 / 8);
+        };
+
+        RoadRoute route{};
+        std::priority_queue<OpenChain> open;
+        std::unordered_map<RoadGraphKey, uint32_t, RoadGraphKeyHash> bestWeighting;
+        uint32_t order = 0;
+        open.push(OpenChain{ heuristic(start.pos), 0, order++, RoadGraphPiece{ start.pos, start.tad, StationId::null, 0 } });
+        bestWeighting[start] = 0;
+
+        size_t numExpanded = 0;
+        while (!open.empty() && numExpanded < kMaxRoadSearchChains)
+        {
+            const auto cur = open.top();
+            open.pop();
+            if (route.weighting && cur.estimate >= *route.weighting)
+            {
+                break;
+            }
+
+            auto key = start;
+            key.pos = cur.piece.pos;
+            key.tad = cur.piece.tad;
+            if (bestWeighting[key] < cur.weighting)
+            {
+                continue;
+            }
+            numExpanded++;
+
+            const auto& chain = getRoadGraphChain(key);
+            auto weighting = cur.weighting;
+            bool hasReachedTarget = false;
+            for (auto i = 0U; i < chain.pieces.size(); ++i)
+            {
+                const auto& piece = i == 0 ? cur.piece : chain.pieces[i];
+                const auto state = getRoadTargetState(piece, allowedStationTypes, target);
+                if (state == RoadTargetState::free)
+                {
+                    if (!route.weighting || weighting < *route.weighting)
+                    {
+                        route.weighting = weighting;
+                        route.reached = piece;
+                    }
+                    hasReachedTarget = true;
+                    break;
+                }
+                if (state == RoadTargetState::occupied)
+                {
+                    route.occupied.push_back(piece);
+                }
+
+                TrackAndDirection::_RoadAndDirection tad{ 0, 0 };
+                tad._data = piece.tad;
+                weighting += World::TrackData::getRoadMiscData(tad.id()).unkWeighting;
+            }
+
+            if (hasReachedTarget || weighting > kMaxRoadSearchWeighting)
+            {
+                continue;
+            }
+            for (const auto& successor : chain.successors)
+            {
+                key.pos = successor.pos;
+                key.tad = successor.tad;
+                auto [it, inserted] = bestWeighting.try_emplace(key, weighting);
+                if (!inserted && it->second <= weighting)
+                {
+                    continue;
+                }
+                it->second = weighting;
+                open.push(OpenChain{ weighting + heuristic(successor.pos), weighting, order++, successor });
+            }
+        }
+        return route;
+    }
+
+    // Returns the weighting of the cheapest route to the target starting with the given road piece
+    static std::optional<uint32_t> roadAStarPathing(const World::Pos3 pos, const uint16_t tad, const CompanyId companyId, const uint8_t roadObjectId, const uint8_t requiredMods, const uint8_t queryMods, const uint32_t allowedStationTypes, const Sub4AC94FTarget& target)
+    {
+        const auto revision = World::Track::getTrackNetworkRevision();
+        if (revision != _roadGraphRevision || _roadGraph.size() >= kMaxCachedRoadChains)
+        {
+            _roadGraph.clear();
+            _roadRoutes.clear();
+            _roadGraphRevision = revision;
+        }
+        if (_roadRoutes.size() >= kMaxCachedRoadRoutes)
+        {
+            _roadRoutes.clear();
+        }
+
+        const RoadGraphKey start{ pos, static_cast<uint16_t>(tad & 0x807FU), companyId, roadObjectId, requiredMods, queryMods };
+        const auto isWaypoint = target.stationId == StationId::null;
+        const RoadRouteKey key{ start, target.stationId, isWaypoint ? 0U : allowedStationTypes, isWaypoint ? target.pos : World::Pos3{}, isWaypoint ? target.tad : uint16_t(0) };
+
+        auto it = _roadRoutes.find(key);
+        if (it == _roadRoutes.end() || !isRoadRouteStillValid(it->second, allowedStationTypes, target))
+        {
+            it = _roadRoutes.insert_or_assign(key, findRoadRoute(start, allowedStationTypes, target)).first;
+        }
+        return it->second.weighting;
+    }
+
     constexpr static std::array<uint16_t, 8> k500234 = {
         10,
         0,
@@ -5394,7 +5630,14 @@ namespace OpenLoco::Vehicles
                     return rc.connections[i];
                 }
 
-                auto newResult = roadTargetedPathing(pos, connection, companyId, roadObjId, requiredMods, queryMods, allowedStationTypes, target);
+                std::optional<uint32_t> aStarWeighting;
+                if (Config::get().roadAStarPathing)
+                {
+                    aStarWeighting = roadAStarPathing(pos, connection, companyId, roadObjId, requiredMods, queryMods, allowedStationTypes, target);
+                }
+                // Falls back to the vanilla search to get as close as possible when the target is out of reach
+                auto newResult = aStarWeighting ? RoutingResult{ 0, *aStarWeighting, RouteSignalState::noSignals }
+                                                : roadTargetedPathing(pos, connection, companyId, roadObjId, requiredMods, queryMods, allowedStationTypes, target);
 
                 if ((state.hadNewResult == 0 && !isSecondRun) || isRoadRoutingResultBetter(state.result, newResult))
                 {
@@ -6628,8 +6871,8 @@ namespace OpenLoco::Vehicles
             updateRoadTileOccupancy(newPos, newTad.road, true);
         }
 
-        auto& moveInfo = mode == TransportMode::road ? World::TrackData::getRoadSubPositon(trackAndDirection.road._data)[subPosition]
-                                                     : World::TrackData::getTrackSubPositon(trackAndDirection.track._data)[subPosition];
+        const auto moveInfo = mode == TransportMode::road ? World::TrackData::getRoadSubPositon(trackAndDirection.road._data)[subPosition]
+                                                          : World::TrackData::getTrackSubPositon(trackAndDirection.track._data)[subPosition];
 
         const auto newEntityPos = newPos + moveInfo.loc;
 
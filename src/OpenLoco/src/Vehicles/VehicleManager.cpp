@@ -131,7 +131,7 @@ namespace OpenLoco::VehicleManager
         base.invalidateSprite();
         if (base.getTransportMode() == TransportMode::road)
         {
-            auto& moveInfo = World::TrackData::getRoadSubPositon(base.getTrackAndDirection().road._data)[base.subPosition];
+            const auto moveInfo = World::TrackData::getRoadSubPositon(base.getTrackAndDirection().road._data)[base.subPosition];
             const auto newPos = World::Pos3{ base.tileX, base.tileY, base.tileBaseZ * World::kSmallZStep } + moveInfo.loc;
             base.spriteYaw = moveInfo.yaw;
             base.spritePitch = moveInfo.pitch;
@@ -139,7 +139,7 @@ namespace OpenLoco::VehicleManager
         }
         else
         {
-            auto& moveInfo = World::TrackData::getTrackSubPositon(base.getTrackAndDirection().track._data)[base.subPosition];
+            const auto moveInfo = World::TrackData::getTrackSubPositon(base.getTrackAndDirection().track._data)[base.subPosition];
             const auto newPos = World::Pos3{ base.tileX, base.tileY, base.tileBaseZ * World::kSmallZStep } + moveInfo.loc;
             base.spriteYaw = moveInfo.yaw;
             base.spritePitch = moveInfo.pitch;
@@ -0,0 +1,136 @@
+#include "Vehicles/WaterPathfinding.h"
+#include "Map/SurfaceElement.h"
+#include "Map/Tile.h"
+#include "Map/TileManager.h"
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+using namespace OpenLoco::World;
+
+namespace OpenLoco::Vehicles
+{
+    bool WaterPassabilityCache::resolve(const World::TilePos2 tilePos) const
+    {
+        if (!validCoords(tilePos))
+        {
+            return false;
+        }
+
+        auto tile = TileManager::get(tilePos);
+        auto* surfaceEntry = tile.surfaceEntry();
+        if (surfaceEntry == nullptr)
+        {
+            return false;
+        }
+
+        auto* surfaceEl = surfaceEntry->as<SurfaceElement>();
+        if (surfaceEl != nullptr && surfaceEl->water() != _waterMicroZ)
+        {
+            return false;
+        }
+        if (!surfaceEntry->isLast())
+        {
+            auto* elObsticle = surfaceEntry->next();
+            if (elObsticle != nullptr && !elObsticle->isGhost() && !elObsticle->isAiAllocated())
+            {
+                if (elObsticle->baseZ() / kMicroToSmallZStep - _waterMicroZ < 1)
+                {
+                    return false;
+                }
+            }
+        }
+
+        const auto nearbyIndex = tilePos - _nearbyVehicles.startTile;
+        // Vanilla made a mistake here so we only check nearby tiles if in range
+        // TODO: When we diverge just change the cost check to >= 6 or increase the search result to 18x18
+        if (nearbyIndex.x >= 0 && nearbyIndex.x < 16 && nearbyIndex.y >= 0 && nearbyIndex.y < 16)
+        {
+            if (_nearbyVehicles.searchResult[nearbyIndex.x][nearbyIndex.y])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool WaterPassabilityCache::isPassable(const World::TilePos2 tilePos)
+    {
+        const auto offset = tilePos - _origin;
+        if (std::abs(offset.x) > kRadius || std::abs(offset.y) > kRadius)
+        {
+            return resolve(tilePos);
+        }
+
+        auto& state = _states[(offset.x + kRadius) * kSize + offset.y + kRadius];
+        if (state == State::unknown)
+        {
+            state = resolve(tilePos) ? State::passable : State::blocked;
+        }
+        return state == State::passable;
+    }
+
+    // 0x00428237
+    // Vanilla recursed into every neighbour up to cost 7 without remembering visited tiles. As each
+    // tile is either passable or not regardless of the route taken, scoring every reachable tile once
+    // at its shortest distance gives the same best (score, cost). Tiles on the target are not expanded.
+    PathFindingResult waterPathfindToTarget(const World::TilePos2 startPos, const World::TilePos2 targetOrderPos, WaterPassabilityCache& passability)
+    {
+        constexpr uint8_t kMaxCost = 7;
+        constexpr int32_t kGridSize = kMaxCost * 2 + 1;
+
+        struct QueueEntry
+        {
+            World::TilePos2 pos;
+            uint8_t cost;
+        };
+
+        PathFindingResult result{ std::numeric_limits<uint16_t>::max(), std::numeric_limits<uint8_t>::max() };
+        if (!passability.isPassable(startPos))
+        {
+            return result;
+        }
+
+        std::array<bool, kGridSize * kGridSize> visited{};
+        std::array<QueueEntry, kGridSize * kGridSize> queue;
+        size_t queueHead = 0;
+        size_t queueTail = 0;
+
+        const auto markVisited = [&visited, startPos](const World::TilePos2 pos) {
+            const auto offset = pos - startPos + World::TilePos2(kMaxCost, kMaxCost);
+            auto& isVisited = visited[offset.x * kGridSize + offset.y];
+            const auto wasVisited = isVisited;
+            isVisited = true;
+            return wasVisited;
+        };
+
+        markVisited(startPos);
+        queue[queueTail++] = QueueEntry{ startPos, 0 };
+        while (queueHead != queueTail)
+        {
+            const auto [tilePos, cost] = queue[queueHead++];
+
+            auto distToTarget = toWorldSpace(tilePos - targetOrderPos);
+            distToTarget.x = std::abs(distToTarget.x);
+            distToTarget.y = std::abs(distToTarget.y);
+            // Lower is better
+            const uint16_t score = std::max(distToTarget.x, distToTarget.y) + std::min(distToTarget.x, distToTarget.y) / 16;
+            result = std::min(result, PathFindingResult{ score, cost });
+            if (score == 0 || cost >= kMaxCost)
+            {
+                continue;
+            }
+
+            for (auto i = 0U; i < 4; ++i)
+            {
+                const auto nextPos = tilePos + toTileSpace(kRotationOffset[i]);
+                if (markVisited(nextPos) || !passability.isPassable(nextPos))
+                {
+                    continue;
+                }
+                queue[queueTail++] = QueueEntry{ nextPos, static_cast<uint8_t>(cost + 1) };
+            }
+        }
+        return result;
+    }
+}
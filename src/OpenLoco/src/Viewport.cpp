@@ -22,8 +22,13 @@
 #include "World/CompanyManager.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
+#include <OpenLoco/Diagnostics/Profiler.h>
 
+#include <algorithm>
 #include <execution>
+#include <limits>
+#include <sfl/small_vector.hpp>
+#include <vector>
 
 using namespace OpenLoco::World;
 
@@ -54,30 +59,168 @@ namespace OpenLoco::Ui
         paint(drawingCtx, uiRect.intersection(viewRect));
     }
 
+    // Station and town labels bucketed by the screen columns they overlap, one set per zoom level.
+    // Buckets list the ids in ascending order so labels are drawn in the same order as before.
+    struct LabelBuckets
+    {
+        int32_t firstBucket = 0;
+        std::vector<uint32_t> bucketStarts = { 0 };
+        std::vector<uint16_t> ids;
+    };
+
+    struct LabelIndex
+    {
+        std::array<LabelBuckets, ZoomLevel::count> stations;
+        std::array<LabelBuckets, ZoomLevel::count> towns;
+    };
+
+    static constexpr int32_t kLabelBucketShift = 5;
+
+    static LabelIndex _labelIndex;
+    static bool _isLabelIndexValid = false;
+
+    void invalidateLabelIndex()
+    {
+        _isLabelIndexValid = false;
+    }
+
+    template<typename TRange>
+    static void buildLabelBuckets(LabelBuckets& buckets, TRange&& items, size_t zoomIndex)
+    {
+        buckets.ids.clear();
+        buckets.bucketStarts.assign(1, 0);
+
+        auto firstBucket = std::numeric_limits<int32_t>::max();
+        auto lastBucket = std::numeric_limits<int32_t>::min();
+        for (const auto& item : items)
+        {
+            firstBucket = std::min(firstBucket, item.labelFrame.left[zoomIndex] >> kLabelBucketShift);
+            lastBucket = std::max(lastBucket, item.labelFrame.right[zoomIndex] >> kLabelBucketShift);
+        }
+        if (firstBucket > lastBucket)
+        {
+            buckets.firstBucket = 0;
+            return;
+        }
+        buckets.firstBucket = firstBucket;
+
+        // Count the labels in each bucket then place them, items are visited in id order both times
+        const auto numBuckets = static_cast<size_t>(lastBucket - firstBucket + 1);
+        std::vector<uint32_t> counts(numBuckets + 1, 0);
+        for (const auto& item : items)
+        {
+            const auto first = (item.labelFrame.left[zoomIndex] >> kLabelBucketShift) - firstBucket;
+            const auto last = (item.labelFrame.right[zoomIndex] >> kLabelBucketShift) - firstBucket;
+            for (auto bucket = first; bucket <= last; bucket++)
+            {
+                counts[bucket + 1]++;
+            }
+        }
+        for (size_t i = 1; i < counts.size(); i++)
+        {
+            counts[i] += counts[i - 1];
+        }
+        buckets.bucketStarts = counts;
+        buckets.ids.resize(counts.back());
+        for (const auto& item : items)
+        {
+            const auto first = (item.labelFrame.left[zoomIndex] >> kLabelBucketShift) - firstBucket;
+            const auto last = (item.labelFrame.right[zoomIndex] >> kLabelBucketShift) - firstBucket;
+            for (auto bucket = first; bucket <= last; bucket++)
+            {
+                buckets.ids[counts[bucket]++] = enumValue(item.id());
+            }
+        }
+    }
+
+    static void updateLabelIndex()
+    {
+        if (_isLabelIndexValid)
+        {
+            return;
+        }
+        OPENLOCO_PROFILE_ZONE("Viewport::updateLabelIndex");
+
+        for (size_t zoomIndex = 0; zoomIndex < ZoomLevel::count; zoomIndex++)
+        {
+            buildLabelBuckets(_labelIndex.stations[zoomIndex], StationManager::stations(), zoomIndex);
+            buildLabelBuckets(_labelIndex.towns[zoomIndex], TownManager::towns(), zoomIndex);
+        }
+        _isLabelIndexValid = true;
+    }
+
+    // Calls func with the ids of the labels in the buckets overlapping the render target, in ascending order
+    template<typename TFunc>
+    static void forEachLabelCandidate(const LabelBuckets& buckets, const Gfx::RenderTarget& rt, TFunc&& func)
+    {
+        const auto numBuckets = static_cast<int32_t>(buckets.bucketStarts.size()) - 1;
+        const auto first = std::max((rt.x >> kLabelBucketShift) - buckets.firstBucket, 0);
+        const auto last = std::min(((rt.x + rt.width - 1) >> kLabelBucketShift) - buckets.firstBucket, numBuckets - 1);
+        if (first > last)
+        {
+            return;
+        }
+
+        // Paint columns are aligned to the buckets so they only ever reach one, which can be walked in place
+        if (first == last)
+        {
+            for (auto i = buckets.bucketStarts[first]; i < buckets.bucketStarts[first + 1]; i++)
+            {
+                func(buckets.ids[i]);
+            }
+            return;
+        }
+
+        sfl::small_vector<uint16_t, 32> candidates;
+        for (auto bucket = first; bucket <= last; bucket++)
+        {
+            const auto begin = buckets.ids.begin() + buckets.bucketStarts[bucket];
+            const auto end = buckets.ids.begin() + buckets.bucketStarts[bucket + 1];
+            candidates.insert(candidates.end(), begin, end);
+        }
+        // Labels spanning several buckets are listed in each of them
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+        for (const auto id : candidates)
+        {
+            func(id);
+        }
+    }
+
     // 0x0048DE97
     static void drawStationNames(Gfx::DrawingContext& drawingCtx, ZoomLevel zoom)
     {
-        for (const auto& station : StationManager::stations())
-        {
-            if ((station.flags & StationFlags::flag_5) != StationFlags::none)
+        const auto& buckets = _labelIndex.stations[zoom.index()];
+        forEachLabelCandidate(buckets, drawingCtx.currentRenderTarget(), [&](const uint16_t id) {
+            const auto* station = StationManager::get(StationId(id));
+            if (station == nullptr || station->empty())
             {
-                continue;
+                return;
+            }
+            if ((station->flags & StationFlags::flag_5) != StationFlags::none)
+            {
+                return;
             }
 
             bool isHovered = (World::hasMapSelectionFlag(World::MapSelectionFlags::hoveringOverStation))
-                && (station.id() == Input::getHoveredStationId());
+                && (station->id() == Input::getHoveredStationId());
 
-            drawStationName(drawingCtx, station, zoom, isHovered);
-        }
+            drawStationName(drawingCtx, *station, zoom, isHovered);
+        });
     }
 
     // 0x004977E5
     static void drawTownNames(Gfx::DrawingContext& drawingCtx, ZoomLevel zoom)
     {
-        for (auto& town : TownManager::towns())
-        {
-            town.drawLabel(drawingCtx, zoom);
-        }
+        const auto& buckets = _labelIndex.towns[zoom.index()];
+        forEachLabelCandidate(buckets, drawingCtx.currentRenderTarget(), [&](const uint16_t id) {
+            auto* town = TownManager::get(TownId(id));
+            if (town == nullptr || town->empty())
+            {
+                return;
+            }
+            town->drawLabel(drawingCtx, zoom);
+        });
     }
 
     // 0x00470A62
@@ -123,6 +266,8 @@ namespace OpenLoco::Ui
     // 0x0045A1A4
     void Viewport::paint(Gfx::DrawingContext& drawingCtx, const Rect& rect)
     {
+        OPENLOCO_PROFILE_ZONE("Viewport::paint");
+
         const auto& rt = drawingCtx.currentRenderTarget();
 
         Paint::SessionOptions options{};
@@ -184,7 +329,12 @@ namespace OpenLoco::Ui
             columns.push_back(columnRt);
         }
 
+        // Labels are looked up from the columns concurrently so the index has to be current beforehand
+        updateLabelIndex();
+
         std::for_each(std::execution::par, columns.begin(), columns.end(), [&](const auto& columnRt) {
+            OPENLOCO_PROFILE_ZONE("Viewport::paintColumn");
+
             // TODO: This bypasses the interface currently, needs refactoring to create a new drawing context per thread.
             Gfx::SoftwareDrawingContext columnDrawingCtx;
             columnDrawingCtx.pushRenderTarget(columnRt);
@@ -993,6 +993,7 @@ namespace OpenLoco
             elBuilding->setAge(0);
             elBuilding->setConstructed(false);
             elBuilding->setUnk5u(0);
+            invalidateCargoContribution(pos);
 
             Ui::ViewportManager::invalidate(World::toWorldSpace(pos), elBuilding->baseHeight(), elBuilding->clearHeight());
 
@@ -28,6 +28,7 @@
 #include "Objects/TrainStationObject.h"
 #include "Random.h"
 #include "Ui/WindowManager.h"
+#include "Viewport.hpp"
 #include "ViewportManager.h"
 #include "World/CompanyManager.h"
 #include "World/IndustryManager.h"
@@ -36,6 +37,9 @@
 #include <OpenLoco/Math/Bound.hpp>
 #include <algorithm>
 #include <cassert>
+#include <optional>
+#include <span>
+#include <vector>
 
 using namespace OpenLoco::World;
 using namespace OpenLoco::Ui;
@@ -49,11 +53,35 @@ namespace OpenLoco
 
     struct CargoMap
     {
+        // Inclusive tile bounds of all tiles that have had a flag set since it was last cleared.
+        struct Bounds
+        {
+            tile_coord_t minX = kMapColumns;
+            tile_coord_t minY = kMapRows;
+            tile_coord_t maxX = -1;
+            tile_coord_t maxY = -1;
+
+            bool isEmpty() const
+            {
+                return maxX < minX || maxY < minY;
+            }
+
+            void include(tile_coord_t x0, tile_coord_t y0, tile_coord_t x1, tile_coord_t y1)
+            {
+                minX = std::min(minX, x0);
+                minY = std::min(minY, y0);
+                maxX = std::max(maxX, x1);
+                maxY = std::max(maxY, y1);
+            }
+        };
+
         std::array<uint8_t, kMapSize> data = {};
+        std::array<Bounds, 2> bounds = {};
 
         void reset()
         {
             data.fill(0);
+            bounds.fill(Bounds{});
         }
 
         bool mapHas1(const tile_coord_t x, const tile_coord_t y) const
@@ -82,6 +110,12 @@ namespace OpenLoco
 
         void setTileRegion(tile_coord_t x, tile_coord_t y, int16_t xTileCount, int16_t yTileCount, const CatchmentFlags flag)
         {
+            if (xTileCount <= 0 || yTileCount <= 0)
+            {
+                return;
+            }
+            bounds[enumValue(flag)].include(x, y, static_cast<tile_coord_t>(x + xTileCount - 1), static_cast<tile_coord_t>(y + yTileCount - 1));
+
             auto xStart = x;
             auto xTileStartCount = xTileCount;
             while (yTileCount > 0)
@@ -100,29 +134,165 @@ namespace OpenLoco
             }
         }
 
-        void resetTileRegion(tile_coord_t x, tile_coord_t y, int16_t xTileCount, int16_t yTileCount, const CatchmentFlags flag)
+        // Clears the flag from every tile, only visiting the region it was set in.
+        void resetFlag(const CatchmentFlags flag)
         {
-            auto xStart = x;
-            auto xTileStartCount = xTileCount;
-            while (yTileCount > 0)
+            auto& flagBounds = bounds[enumValue(flag)];
+            if (flagBounds.isEmpty())
             {
-                while (xTileCount > 0)
+                return;
+            }
+            for (auto y = flagBounds.minY; y <= flagBounds.maxY; y++)
+            {
+                for (auto x = flagBounds.minX; x <= flagBounds.maxX; x++)
                 {
                     resetTile(x, y, flag);
-                    x++;
-                    xTileCount--;
                 }
-
-                x = xStart;
-                xTileCount = xTileStartCount;
-                y++;
-                yTileCount--;
             }
+            flagBounds = {};
+        }
+
+        const Bounds& getBounds(const CatchmentFlags flag) const
+        {
+            return bounds[enumValue(flag)];
         }
     };
 
     static CargoMap _cargoMap; // 0x00F00484
 
+    // What a single non ghost building or industry element on a tile contributes to the
+    // cargo acceptance of any station whose catchment covers it.
+    struct CargoContribution
+    {
+        // Industries are resolved when summing as their construction state is not stored on the tile.
+        IndustryId industryId = IndustryId::null;
+        std::array<uint8_t, 2> producedCargoType = { 0xFF, 0xFF };
+        std::array<uint8_t, 2> producedCargoQty = {};
+        std::array<bool, 2> hasProducedQuantity = {};
+        std::array<uint8_t, 2> consumedCargoType = { 0xFF, 0xFF };
+        std::array<uint8_t, 2> consumedCargoQty = {};
+        // Set for large buildings, the tile of sequence index 0.
+        std::optional<TilePos2> largeTileOrigin;
+    };
+
+    struct CargoContributionCache
+    {
+        static constexpr uint32_t kUnknown = 0xFFFFFFFF;
+        // Invalidated entries stay in the pool until there are this many and they make up half of it
+        static constexpr size_t kMaxStaleContributions = 4096;
+
+        // Per tile, the index of its first contribution in the pool or kUnknown if not built yet
+        std::array<uint32_t, kMapSize> first;
+        std::array<uint8_t, kMapSize> counts;
+        std::vector<CargoContribution> pool;
+        size_t numStale = 0;
+
+        CargoContributionCache()
+        {
+            reset();
+        }
+
+        static uint32_t getIndex(const TilePos2& pos)
+        {
+            return pos.y * kMapColumns + pos.x;
+        }
+
+        void reset()
+        {
+            first.fill(kUnknown);
+            counts.fill(0);
+            pool.clear();
+            numStale = 0;
+        }
+
+        void invalidate(const TilePos2& pos)
+        {
+            if (!World::validCoords(pos))
+            {
+                return;
+            }
+            const auto index = getIndex(pos);
+            numStale += counts[index];
+            first[index] = kUnknown;
+            counts[index] = 0;
+        }
+
+        // The span is only valid until the next call as building a tile can grow the pool
+        std::span<const CargoContribution> get(const TilePos2& pos)
+        {
+            const auto index = getIndex(pos);
+            if (first[index] == kUnknown)
+            {
+                if (numStale >= kMaxStaleContributions && numStale * 2 >= pool.size())
+                {
+                    reset();
+                }
+                first[index] = static_cast<uint32_t>(pool.size());
+                build(pos, pool);
+                counts[index] = static_cast<uint8_t>(pool.size() - first[index]);
+            }
+            return { pool.data() + first[index], counts[index] };
+        }
+
+    private:
+        static void build(const TilePos2& pos, std::vector<CargoContribution>& result)
+        {
+            auto tile = TileManager::get(pos);
+            for (auto& el : tile)
+            {
+                if (el.isGhost())
+                {
+                    continue;
+                }
+                switch (el.type())
+                {
+                    case ElementType::industry:
+                    {
+                        CargoContribution contribution{};
+                        contribution.industryId = el.get<IndustryElement>().industryId();
+                        result.push_back(contribution);
+                        break;
+                    }
+                    case ElementType::building:
+                    {
+                        auto& buildingEl = el.get<BuildingElement>();
+                        if (buildingEl.isMiscBuilding() || !buildingEl.isConstructed())
+                        {
+                            break;
+                        }
+
+                        const auto* obj = buildingEl.getObject();
+                        if (obj == nullptr)
+                        {
+                            break;
+                        }
+
+                        CargoContribution contribution{};
+                        for (int i = 0; i < 2; i++)
+                        {
+                            contribution.producedCargoType[i] = obj->producedCargoType[i];
+                            contribution.producedCargoQty[i] = obj->producedCargoQty[i];
+                            contribution.hasProducedQuantity[i] = obj->producedQuantity[i] != 0;
+                            contribution.consumedCargoType[i] = obj->consumedCargoType[i];
+                            contribution.consumedCargoQty[i] = obj->consumedCargoQty[i];
+                        }
+                        if (obj->hasFlags(BuildingObjectFlags::largeTile))
+                        {
+                            const auto offset = World::kOffsets[buildingEl.sequenceIndex()];
+                            contribution.largeTileOrigin = toTileSpace(toWorldSpace(pos) - offset);
+                        }
+                        result.push_back(contribution);
+                        break;
+                    }
+                    default:
+                        break;
+                }
+            }
+        }
+    };
+
+    static CargoContributionCache _cargoContributions;
+
     struct CargoSearchState
     {
     private:
@@ -308,114 +478,83 @@ namespace OpenLoco
             cargoSearchState.filter(~0U);
         }
 
-        for (tile_coord_t ty = 0; ty < kMapColumns; ty++)
+        // Only the catchment built up by setCatchmentDisplay and friends can have the flag set.
+        const auto catchmentBounds = _cargoMap.getBounds(CatchmentFlags::flag_1);
+        for (tile_coord_t ty = catchmentBounds.minY; ty <= catchmentBounds.maxY; ty++)
         {
-            for (tile_coord_t tx = 0; tx < kMapRows; tx++)
+            for (tile_coord_t tx = catchmentBounds.minX; tx <= catchmentBounds.maxX; tx++)
             {
-                if (_cargoMap.mapHas2(tx, ty))
+                if (!_cargoMap.mapHas2(tx, ty))
                 {
-                    auto pos = Pos2(tx * kTileSize, ty * kTileSize);
-                    auto tile = TileManager::get(pos);
+                    continue;
+                }
 
-                    for (auto& el : tile)
+                for (const auto& contribution : _cargoContributions.get(TilePos2(tx, ty)))
+                {
+                    if (contribution.industryId != IndustryId::null)
                     {
-                        if (el.isGhost())
+                        auto* industry = IndustryManager::get(contribution.industryId);
+                        if (industry == nullptr || industry->under_construction != 0xFF)
                         {
                             continue;
                         }
-                        switch (el.type())
+                        const auto* obj = industry->getObject();
+                        if (obj == nullptr)
                         {
-                            case ElementType::industry:
-                            {
-                                auto& industryEl = el.get<IndustryElement>();
-                                auto* industry = industryEl.industry();
-
-                                if (industry == nullptr || industry->under_construction != 0xFF)
-                                {
-                                    break;
-                                }
-                                const auto* obj = industry->getObject();
-
-                                if (obj == nullptr)
-                                {
-                                    break;
-                                }
-
-                                for (auto cargoId : obj->requiredCargoType)
-                                {
-                                    if (cargoId != 0xFF && (cargoSearchState.filter() & (1 << cargoId)))
-                                    {
-                                        cargoSearchState.addScore(cargoId, 8);
-                                        cargoSearchState.setIndustry(cargoId, industry->id());
-                                    }
-                                }
-
-                                for (auto cargoId : obj->producedCargoType)
-                                {
-                                    if (cargoId != 0xFF && (cargoSearchState.filter() & (1 << cargoId)))
-                                    {
-                                        cargoSearchState.addProducedCargoType(cargoId);
-                                    }
-                                }
+                            continue;
+                        }
 
-                                break;
-                            }
-                            case ElementType::building:
+                        for (auto cargoId : obj->requiredCargoType)
+                        {
+                            if (cargoId != 0xFF && (cargoSearchState.filter() & (1 << cargoId)))
                             {
-                                auto& buildingEl = el.get<BuildingElement>();
-
-                                if (buildingEl.isMiscBuilding() || !buildingEl.isConstructed())
-                                {
-                                    break;
-                                }
-
-                                const auto* obj = buildingEl.getObject();
-
-                                if (obj == nullptr)
-                                {
-                                    break;
-                                }
-                                for (int i = 0; i < 2; i++)
-                                {
-                                    const auto cargoId = obj->producedCargoType[i];
-                                    if (cargoId != 0xFF && (cargoSearchState.filter() & (1 << cargoId)))
-                                    {
-                                        cargoSearchState.addScore(cargoId, obj->producedCargoQty[i]);
-
-                                        if (obj->producedQuantity[i] != 0)
-                                        {
-                                            cargoSearchState.addProducedCargoType(cargoId);
-                                        }
-                                    }
-                                }
+                                cargoSearchState.addScore(cargoId, 8);
+                                cargoSearchState.setIndustry(cargoId, industry->id());
+                            }
+                        }
 
-                                for (int i = 0; i < 2; i++)
-                                {
-                                    if (obj->consumedCargoType[i] != 0xFF && (cargoSearchState.filter() & (1 << obj->consumedCargoType[i])))
-                                    {
-                                        cargoSearchState.addScore(obj->consumedCargoType[i], obj->consumedCargoQty[i]);
-                                    }
-                                }
+                        for (auto cargoId : obj->producedCargoType)
+                        {
+                            if (cargoId != 0xFF && (cargoSearchState.filter() & (1 << cargoId)))
+                            {
+                                cargoSearchState.addProducedCargoType(cargoId);
+                            }
+                        }
+                        continue;
+                    }
 
-                                // Multi tile buildings should only be counted once so remove the other tiles from the search
-                                if (obj->hasFlags(BuildingObjectFlags::largeTile))
-                                {
-                                    auto index = buildingEl.sequenceIndex();
-                                    tile_coord_t xPos = (pos.x - World::kOffsets[index].x) / kTileSize;
-                                    tile_coord_t yPos = (pos.y - World::kOffsets[index].y) / kTileSize;
-
-                                    _cargoMap.mapRemove2(xPos + 0, yPos + 0);
-                                    _cargoMap.mapRemove2(xPos + 0, yPos + 1);
-                                    _cargoMap.mapRemove2(xPos + 1, yPos + 0);
-                                    _cargoMap.mapRemove2(xPos + 1, yPos + 1);
-                                }
+                    for (int i = 0; i < 2; i++)
+                    {
+                        const auto cargoId = contribution.producedCargoType[i];
+                        if (cargoId != 0xFF && (cargoSearchState.filter() & (1 << cargoId)))
+                        {
+                            cargoSearchState.addScore(cargoId, contribution.producedCargoQty[i]);
 
-                                break;
+                            if (contribution.hasProducedQuantity[i])
+                            {
+                                cargoSearchState.addProducedCargoType(cargoId);
                             }
-                            default:
-                                continue;
                         }
                     }
+
+                    for (int i = 0; i < 2; i++)
+                    {
+                        const auto cargoId = contribution.consumedCargoType[i];
+                        if (cargoId != 0xFF && (cargoSearchState.filter() & (1 << cargoId)))
+                        {
+                            cargoSearchState.addScore(cargoId, contribution.consumedCargoQty[i]);
+                        }
+                    }
+
+                    // Multi tile buildings should only be counted once so remove the other tiles from the search
+                    if (contribution.largeTileOrigin.has_value())
+                    {
+                        const auto origin = *contribution.largeTileOrigin;
+                        _cargoMap.mapRemove2(origin.x + 0, origin.y + 0);
+                        _cargoMap.mapRemove2(origin.x + 0, origin.y + 1);
+                        _cargoMap.mapRemove2(origin.x + 1, origin.y + 0);
+                        _cargoMap.mapRemove2(origin.x + 1, origin.y + 1);
+                    }
                 }
             }
         }
@@ -543,7 +682,7 @@ namespace OpenLoco
     // catchment flag should not be shifted (1, 2, 3, 4) and NOT (1 << 0, 1 << 1)
     void setCatchmentDisplay(const Station* station, const CatchmentFlags catchmentFlag)
     {
-        _cargoMap.resetTileRegion(0, 0, kMapColumns, kMapRows, catchmentFlag);
+        _cargoMap.resetFlag(catchmentFlag);
 
         if (station == nullptr)
         {
@@ -613,6 +752,16 @@ namespace OpenLoco
         }
     }
 
+    void invalidateCargoContribution(const World::TilePos2& pos)
+    {
+        _cargoContributions.invalidate(pos);
+    }
+
+    void resetCargoContributions()
+    {
+        _cargoContributions.reset();
+    }
+
     bool isWithinCatchmentDisplay(const World::Pos2 pos)
     {
         const auto tilePos = World::toTileSpace(pos);
@@ -1002,6 +1151,7 @@ namespace OpenLoco
             labelFrame.top[index] = uiTop;
             labelFrame.bottom[index] = uiTop + height;
         }
+        Ui::invalidateLabelIndex();
     }
 
     // 0x004CBA2D
@@ -1240,6 +1390,7 @@ namespace OpenLoco
         station->stationTiles[station->stationTileSize].z &= ~0x3;
         station->stationTiles[station->stationTileSize].z |= (rotation & 0x3);
         station->stationTileSize++;
+        StationManager::updateSpatialIndex(stationId);
 
         CargoSearchState cargoSearchState;
         const auto acceptedCargos = station->calcAcceptedCargo(cargoSearchState);
@@ -1291,6 +1442,7 @@ namespace OpenLoco
         {
             // Bug mitigation: ensure stationTileSize does not exceed the actual array length
             station->stationTileSize = std::clamp<int16_t>(station->stationTileSize - 1, 0, static_cast<uint16_t>(std::size(station->stationTiles)));
+            StationManager::updateSpatialIndex(stationId);
             return;
         }
 
@@ -1298,6 +1450,7 @@ namespace OpenLoco
         std::rotate(foundTilePos, foundTilePos + 1, std::end(station->stationTiles));
         station->stationTileSize--;
         station->stationTiles[std::size(station->stationTiles) - 1] = World::Pos3{};
+        StationManager::updateSpatialIndex(stationId);
     }
 
     // 0x0048F482
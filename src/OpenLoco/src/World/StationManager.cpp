@@ -11,7 +11,9 @@
 #include "Map/SurfaceElement.h"
 #include "Map/TileManager.h"
 #include "MessageManager.h"
+#include "Objects/AirportObject.h"
 #include "Objects/IndustryObject.h"
+#include "Objects/ObjectManager.h"
 #include "Scenario/ScenarioManager.h"
 #include "SceneManager.h"
 #include "Ui/Window.h"
@@ -26,7 +28,9 @@
 #include <OpenLoco/Math/Vector.hpp>
 #include <bitset>
 #include <numeric>
+#include <sfl/small_vector.hpp>
 #include <sfl/static_vector.hpp>
+#include <vector>
 
 using namespace OpenLoco::Ui;
 using namespace OpenLoco::World;
@@ -35,6 +39,20 @@ namespace OpenLoco::StationManager
 {
     constexpr auto kStationDistanceLimit = 8 * World::kTileSize;
 
+    // Each spatial index cell covers 8x8 tiles.
+    constexpr int32_t kSpatialCellShift = 3;
+    constexpr int32_t kSpatialCellMask = (1 << kSpatialCellShift) - 1;
+    constexpr int32_t kSpatialCellColumns = World::kMapColumns >> kSpatialCellShift;
+    constexpr int32_t kSpatialCellRows = World::kMapRows >> kSpatialCellShift;
+    constexpr int32_t kSpatialCellCount = kSpatialCellColumns * kSpatialCellRows;
+
+    // Track and road station tiles are registered by the start of their track piece which
+    // can span several tiles.
+    constexpr int16_t kSpatialTrackPieceMargin = 4;
+
+    static std::array<sfl::small_vector<StationId, 2>, kSpatialCellCount> _spatialCells;
+    static std::array<std::vector<uint16_t>, Limits::kMaxStations> _stationSpatialCells;
+
     static auto& rawStations() { return getGameState().stations; }
 
     // 0x0048B1D8
@@ -44,6 +62,7 @@ namespace OpenLoco::StationManager
         {
             station.name = StringIds::null;
         }
+        resetSpatialIndex();
         Ui::Windows::Station::reset();
     }
 
@@ -456,6 +475,103 @@ namespace OpenLoco::StationManager
         }
     }
 
+    static uint16_t getSpatialCellIndex(const TilePos2& pos)
+    {
+        return static_cast<uint16_t>((pos.y >> kSpatialCellShift) * kSpatialCellColumns + (pos.x >> kSpatialCellShift));
+    }
+
+    static bool hasStationsInCell(const TilePos2& pos)
+    {
+        return !_spatialCells[getSpatialCellIndex(pos)].empty();
+    }
+
+    static bool hasStationsInRegion(const TilePos2& posA, const TilePos2& posB)
+    {
+        const auto minPos = TilePos2(World::clampTileCoord(posA.x), World::clampTileCoord(posA.y));
+        const auto maxPos = TilePos2(World::clampTileCoord(posB.x), World::clampTileCoord(posB.y));
+        for (auto cellY = minPos.y >> kSpatialCellShift; cellY <= maxPos.y >> kSpatialCellShift; cellY++)
+        {
+            for (auto cellX = minPos.x >> kSpatialCellShift; cellX <= maxPos.x >> kSpatialCellShift; cellX++)
+            {
+                if (!_spatialCells[cellY * kSpatialCellColumns + cellX].empty())
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Returns the tiles that may contain elements of the registered station tile.
+    // Mirrors the extents used by setCatchmentDisplay.
+    static std::pair<TilePos2, TilePos2> getStationTileExtents(World::Pos3 pos)
+    {
+        pos.z = World::heightFloor(pos.z);
+        const auto tilePos = World::toTileSpace(pos);
+
+        auto* elStation = getStationElement(pos);
+        if (elStation != nullptr && elStation->stationType() == StationType::airport)
+        {
+            auto* airportObj = ObjectManager::get<AirportObject>(elStation->objectId());
+            return airportObj->getAirportExtents(tilePos, elStation->rotation());
+        }
+        if (elStation != nullptr && elStation->stationType() == StationType::docks)
+        {
+            // Docks are always size 2x2
+            return { tilePos, tilePos + TilePos2(1, 1) };
+        }
+        return { tilePos - TilePos2(kSpatialTrackPieceMargin, kSpatialTrackPieceMargin), tilePos + TilePos2(kSpatialTrackPieceMargin, kSpatialTrackPieceMargin) };
+    }
+
+    void updateSpatialIndex(const StationId stationId)
+    {
+        auto& stationCells = _stationSpatialCells[enumValue(stationId)];
+        for (auto cellIndex : stationCells)
+        {
+            auto& cell = _spatialCells[cellIndex];
+            cell.erase(std::remove(cell.begin(), cell.end(), stationId), cell.end());
+        }
+        stationCells.clear();
+
+        auto* station = get(stationId);
+        if (station == nullptr || station->empty())
+        {
+            return;
+        }
+
+        for (auto i = 0U; i < station->stationTileSize; ++i)
+        {
+            const auto [minPos, maxPos] = getStationTileExtents(station->stationTiles[i]);
+            for (const auto& tilePos : World::getClampedRange(minPos, maxPos))
+            {
+                const auto cellIndex = getSpatialCellIndex(tilePos);
+                if (std::find(stationCells.begin(), stationCells.end(), cellIndex) != stationCells.end())
+                {
+                    continue;
+                }
+                stationCells.push_back(cellIndex);
+                _spatialCells[cellIndex].push_back(stationId);
+            }
+        }
+    }
+
+    void resetSpatialIndex()
+    {
+        for (auto& cell : _spatialCells)
+        {
+            cell.clear();
+        }
+        for (auto& stationCells : _stationSpatialCells)
+        {
+            stationCells.clear();
+        }
+
+        for (auto& station : stations())
+        {
+            updateSpatialIndex(station.id());
+        }
+    }
+
     using CargoStations = sfl::static_vector<std::pair<StationId, uint8_t>, 16>;
 
     static CargoStations findStationsForCargoType(const uint8_t cargoType, const World::Pos2& pos, const World::TilePos2& size)
@@ -464,6 +580,12 @@ namespace OpenLoco::StationManager
         const auto catchmentSize = size + TilePos2(8, 8);
 
         CargoStations foundStations;
+
+        // Most producers have no station nearby at all.
+        if (!hasStationsInRegion(initialLoc, initialLoc + catchmentSize - TilePos2(1, 1)))
+        {
+            return foundStations;
+        }
         for (TilePos2 searchOffset{ 0, 0 }; searchOffset.y < catchmentSize.y; ++searchOffset.y)
         {
             for (; searchOffset.x < catchmentSize.x; ++searchOffset.x)
@@ -474,6 +596,14 @@ namespace OpenLoco::StationManager
                     continue;
                 }
 
+                // No registered station is close enough to have an element on this tile or the
+                // rest of the cell's row.
+                if (!hasStationsInCell(searchLoc))
+                {
+                    searchOffset.x += kSpatialCellMask - (searchLoc.x & kSpatialCellMask);
+                    continue;
+                }
+
                 const auto tile = TileManager::get(searchLoc);
                 for (const auto& el : tile)
                 {
@@ -706,6 +836,7 @@ namespace OpenLoco::StationManager
         MessageManager::removeAllSubjectRefs(enumValue(stationId), MessageItemArgumentType::station);
         StringManager::emptyUserString(station->name);
         station->name = StringIds::null;
+        updateSpatialIndex(stationId);
     }
 
     StationId findNearbyEmptyStation(const World::Pos3 pos, const CompanyId companyId, const int16_t currentMinDistanceStation)
@@ -756,6 +887,11 @@ namespace OpenLoco::StationManager
         bool isPhysicallyAttached = false;
         for (const auto& tilePos : World::getClampedRange(tilePosA, tilePosB))
         {
+            if (!hasStationsInCell(tilePos))
+            {
+                continue;
+            }
+
             const auto tile = World::TileManager::get(tilePos);
             for (const auto& el : tile)
             {
@@ -28,6 +28,7 @@
 #include "Objects/StreetLightObject.h"
 #include "Random.h"
 #include "Ui/WindowManager.h"
+#include "Viewport.hpp"
 #include "Vehicles/Vehicle.h"
 #include "ViewportManager.h"
 #include "World/TownManager.h"
@@ -136,6 +137,7 @@ namespace OpenLoco
             labelFrame.top[index] = zoom.applyInversedTo(yOffset);
             labelFrame.bottom[index] = labelFrame.top[index] + uiHeight;
         }
+        Ui::invalidateLabelIndex();
     }
 
     // 0x0049749B
@@ -860,6 +862,8 @@ namespace OpenLoco
                 }
                 elRoad->setOwner(newOwner);
                 elRoad->setRoadObjectId(newRoadObjId);
+                // Road pathing caches built on the old owner and road object are now stale
+                World::Track::invalidateTrackNetwork();
                 if (!elRoad->hasLevelCrossing())
                 {
                     elRoad->setStreetLightStyle(newStreetLightStyle);
@@ -0,0 +1,358 @@
+#include <OpenLoco/Graphics/DrawSpriteBMP.hpp>
+#include <OpenLoco/Graphics/DrawSpriteHelper.hpp>
+#include <OpenLoco/Graphics/DrawSpriteRLE.hpp>
+#include <OpenLoco/Graphics/Gfx.h>
+#include <OpenLoco/Graphics/RenderTarget.h>
+#include <OpenLoco/Graphics/SpriteCache.h>
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace OpenLoco;
+using namespace OpenLoco::Gfx;
+
+namespace
+{
+    // Random palette map with plenty of transparent entries
+    std::vector<uint8_t> makePaletteMap(uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::vector<uint8_t> paletteMap(PaletteMap::kDefaultSize * PaletteMap::kDefaultSize);
+        for (auto& pixel : paletteMap)
+        {
+            const auto value = static_cast<uint8_t>(rng());
+            pixel = (value & 0x3) == 0 ? PaletteIndex::transparent : value;
+        }
+        return paletteMap;
+    }
+
+    constexpr int16_t kRLEWidth = 150;
+    constexpr int16_t kRLEHeight = 41;
+
+    // Random RLE image with gaps, empty lines and runs containing transparent pixels
+    std::vector<uint8_t> makeRLEImage(uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::vector<uint8_t> data(kRLEHeight * 2);
+        for (int32_t y = 0; y < kRLEHeight; ++y)
+        {
+            const auto lineOffset = data.size();
+            data[y * 2] = lineOffset & 0xFF;
+            data[y * 2 + 1] = lineOffset >> 8;
+
+            size_t lastRun = 0;
+            int32_t x = (y % 7 == 3) ? kRLEWidth : static_cast<int32_t>(rng() % 20);
+            bool hasRun = false;
+            while (x < kRLEWidth)
+            {
+                const auto numPixels = std::min<int32_t>(1 + rng() % 0x7F, kRLEWidth - x);
+                lastRun = data.size();
+                data.push_back(static_cast<uint8_t>(numPixels));
+                data.push_back(static_cast<uint8_t>(x));
+                for (int32_t i = 0; i < numPixels; ++i)
+                {
+                    const auto pixel = static_cast<uint8_t>(rng());
+                    data.push_back((pixel & 0xF) == 0 ? PaletteIndex::transparent : pixel);
+                }
+                hasRun = true;
+                x += numPixels + static_cast<int32_t>(rng() % 12);
+            }
+            if (hasRun)
+            {
+                data[lastRun] |= 0x80;
+            }
+            else
+            {
+                data.push_back(0x80);
+                data.push_back(0);
+            }
+        }
+        return data;
+    }
+
+    template<DrawBlendOp TBlendOp, uint8_t TZoomLevel>
+    void checkCachedRLEMatchesRLE()
+    {
+        constexpr int32_t zoom = 1 << TZoomLevel;
+        constexpr int32_t kTargetWidth = 160;
+        constexpr int32_t kTargetHeight = 48;
+
+        auto image = makeRLEImage(TZoomLevel);
+        G1Element element{};
+        element.offset = image.data();
+        element.width = kRLEWidth;
+        element.height = kRLEHeight;
+        // Images are only drawn without the transparent op when they have no transparency
+        element.flags = G1ElementFlags::isRLECompressed;
+        if constexpr (TBlendOp != DrawBlendOp::none)
+        {
+            element.flags |= G1ElementFlags::hasTransparency;
+        }
+
+        const auto paletteMapData = makePaletteMap(TZoomLevel);
+        const PaletteMap::View paletteMap{ paletteMapData };
+
+        std::mt19937 rng(TZoomLevel);
+        std::vector<uint8_t> background(kTargetWidth * kTargetHeight);
+        for (auto& pixel : background)
+        {
+            pixel = static_cast<uint8_t>(rng());
+        }
+
+        for (int32_t srcY = 1 - zoom; srcY < zoom + 3; ++srcY)
+        {
+            for (int32_t srcX = 1 - zoom; srcX < 2 * zoom + 5; ++srcX)
+            {
+                const auto width = kRLEWidth - std::max(srcX, 0) - static_cast<int32_t>(rng() % 16);
+                const auto height = kRLEHeight - std::max(srcY, 0) - static_cast<int32_t>(rng() % 8);
+                const DrawSpriteArgs args{ paletteMap, element, Ui::Point(srcX, srcY), Ui::Point(3, 2), Ui::Size(width, height), nullptr };
+
+                auto expected = background;
+                const RenderTarget expectedRt{ expected.data(), 0, 0, kTargetWidth, kTargetHeight, 0 };
+                drawRLESprite<TBlendOp, TZoomLevel>(expectedRt, args);
+
+                auto actual = background;
+                const RenderTarget actualRt{ actual.data(), 0, 0, kTargetWidth, kTargetHeight, 0 };
+                drawSpriteToBuffer<TZoomLevel, true>(actualRt, args, TBlendOp);
+
+                ASSERT_EQ(actual, expected) << "zoom " << static_cast<int>(TZoomLevel) << " src " << srcX << "," << srcY;
+            }
+        }
+    }
+
+    template<DrawBlendOp TBlendOp>
+    void checkCachedRLEAllZoomLevels()
+    {
+        checkCachedRLEMatchesRLE<TBlendOp, 1>();
+        checkCachedRLEMatchesRLE<TBlendOp, 2>();
+        checkCachedRLEMatchesRLE<TBlendOp, 3>();
+    }
+
+    constexpr auto kThreadedOp = DrawBlendOp::transparent | DrawBlendOp::src;
+
+    // Draws without the cache, zoom levels below 0 are magnified
+    void drawRLEAtZoom(const RenderTarget& rt, const DrawSpriteArgs& args, int8_t zoomLevel)
+    {
+        switch (zoomLevel)
+        {
+            case 1:
+                drawRLESprite<kThreadedOp, 1>(rt, args);
+                break;
+            case 2:
+                drawRLESprite<kThreadedOp, 2>(rt, args);
+                break;
+            case 3:
+                drawRLESprite<kThreadedOp, 3>(rt, args);
+                break;
+            default:
+                drawRLESpriteMagnify<kThreadedOp>(rt, ZoomLevel(zoomLevel), args);
+                break;
+        }
+    }
+
+    // Draws through the cache, zoom levels below 0 are magnified
+    void drawCachedRLEAtZoom(const RenderTarget& rt, const DrawSpriteArgs& args, int8_t zoomLevel)
+    {
+        switch (zoomLevel)
+        {
+            case 1:
+                drawSpriteToBuffer<1, true>(rt, args, kThreadedOp);
+                break;
+            case 2:
+                drawSpriteToBuffer<2, true>(rt, args, kThreadedOp);
+                break;
+            case 3:
+                drawSpriteToBuffer<3, true>(rt, args, kThreadedOp);
+                break;
+            default:
+                drawSpriteToBufferMagnify<true>(rt, ZoomLevel(zoomLevel), args, kThreadedOp);
+                break;
+        }
+    }
+}
+
+TEST(DrawSpriteTest, BMPTransparentMatchesBlitPixel)
+{
+    constexpr int32_t kWidth = 67;
+    constexpr int32_t kHeight = 23;
+    constexpr int32_t kTargetWidth = 80;
+    constexpr int32_t kTargetHeight = 30;
+
+    std::mt19937 rng(5);
+    std::vector<uint8_t> image(kWidth * kHeight);
+    for (auto& pixel : image)
+    {
+        const auto value = static_cast<uint8_t>(rng());
+        pixel = (value & 0x3) == 0 ? PaletteIndex::transparent : value;
+    }
+    G1Element element{};
+    element.offset = image.data();
+    element.width = kWidth;
+    element.height = kHeight;
+    element.flags = G1ElementFlags::hasTransparency;
+
+    std::vector<uint8_t> background(kTargetWidth * kTargetHeight);
+    for (auto& pixel : background)
+    {
+        pixel = static_cast<uint8_t>(rng());
+    }
+    const auto paletteMapData = makePaletteMap(5);
+    const PaletteMap::View paletteMap{ paletteMapData };
+
+    for (int32_t srcY = 0; srcY < 3; ++srcY)
+    {
+        for (int32_t srcX = 0; srcX < 5; ++srcX)
+        {
+            const auto width = kWidth - srcX - static_cast<int32_t>(rng() % 16);
+            const auto height = kHeight - srcY - static_cast<int32_t>(rng() % 8);
+
+            auto expected = background;
+            for (int32_t y = 0; y < height; ++y)
+            {
+                for (int32_t x = 0; x < width; ++x)
+                {
+                    blitPixel<DrawBlendOp::transparent>(image[(srcY + y) * kWidth + srcX + x], expected[(2 + y) * kTargetWidth + 3 + x], paletteMap, 0xFF);
+                }
+            }
+
+            auto actual = background;
+            const RenderTarget rt{ actual.data(), 0, 0, kTargetWidth, kTargetHeight, 0 };
+            const DrawSpriteArgs args{ paletteMap, element, Ui::Point(srcX, srcY), Ui::Point(3, 2), Ui::Size(width, height), nullptr };
+            drawBMPSprite<DrawBlendOp::transparent, 0>(rt, args);
+
+            ASSERT_EQ(actual, expected) << "src " << srcX << "," << srcY;
+        }
+    }
+}
+
+TEST(DrawSpriteTest, CachedRLEMatchesRLE)
+{
+    checkCachedRLEAllZoomLevels<DrawBlendOp::none>();
+    checkCachedRLEAllZoomLevels<DrawBlendOp::transparent>();
+    checkCachedRLEAllZoomLevels<DrawBlendOp::transparent | DrawBlendOp::src>();
+    checkCachedRLEAllZoomLevels<DrawBlendOp::transparent | DrawBlendOp::dst>();
+    checkCachedRLEAllZoomLevels<DrawBlendOp::transparent | DrawBlendOp::src | DrawBlendOp::dst>();
+    SpriteCache::invalidate();
+}
+
+TEST(DrawSpriteTest, CachedRLEMagnifyMatchesRLE)
+{
+    auto image = makeRLEImage(7);
+    G1Element element{};
+    element.offset = image.data();
+    element.width = kRLEWidth;
+    element.height = kRLEHeight;
+    element.flags = G1ElementFlags::isRLECompressed | G1ElementFlags::hasTransparency;
+
+    const auto paletteMapData = makePaletteMap(7);
+    const PaletteMap::View paletteMap{ paletteMapData };
+    constexpr auto kOp = DrawBlendOp::transparent | DrawBlendOp::src;
+
+    constexpr int32_t kTargetWidth = 200;
+    constexpr int32_t kTargetHeight = 90;
+    const std::vector<uint8_t> background(kTargetWidth * kTargetHeight, 0x55);
+    for (int8_t zoom = -2; zoom < 0; ++zoom)
+    {
+        const DrawSpriteArgs args{ paletteMap, element, Ui::Point(5, 3), Ui::Point(1, 2), Ui::Size(kTargetWidth - 1, kTargetHeight - 12), nullptr };
+
+        auto expected = background;
+        const RenderTarget expectedRt{ expected.data(), 0, 0, kTargetWidth, kTargetHeight, 0 };
+        drawRLESpriteMagnify<kOp>(expectedRt, ZoomLevel(zoom), args);
+
+        auto actual = background;
+        const RenderTarget actualRt{ actual.data(), 0, 0, kTargetWidth, kTargetHeight, 0 };
+        drawSpriteToBufferMagnify<true>(actualRt, ZoomLevel(zoom), args, kOp);
+
+        EXPECT_EQ(actual, expected) << "zoom " << static_cast<int>(zoom);
+    }
+    SpriteCache::invalidate();
+}
+
+TEST(DrawSpriteTest, CachedRLEFromSeveralThreads)
+{
+    constexpr int32_t kNumImages = 6;
+    constexpr int8_t kZoomLevels[] = { -1, 1, 2, 3 };
+    constexpr int32_t kTargetWidth = 160;
+    constexpr int32_t kTargetHeight = 90;
+
+    std::vector<std::vector<uint8_t>> images;
+    for (int32_t i = 0; i < kNumImages; ++i)
+    {
+        images.push_back(makeRLEImage(20 + i));
+    }
+    std::vector<G1Element> elements(kNumImages);
+    for (int32_t i = 0; i < kNumImages; ++i)
+    {
+        elements[i].offset = images[i].data();
+        elements[i].width = kRLEWidth;
+        elements[i].height = kRLEHeight;
+        elements[i].flags = G1ElementFlags::isRLECompressed | G1ElementFlags::hasTransparency;
+    }
+
+    const auto paletteMapData = makePaletteMap(20);
+    const PaletteMap::View paletteMap{ paletteMapData };
+    const std::vector<uint8_t> background(kTargetWidth * kTargetHeight, 0x55);
+    const auto makeArgs = [&](int32_t image, int8_t zoomLevel) {
+        const auto phase = zoomLevel > 0 ? image % (1 << zoomLevel) : 0;
+        return DrawSpriteArgs{ paletteMap, elements[image], Ui::Point(phase, phase), Ui::Point(2, 1), Ui::Size(kRLEWidth - phase, kRLEHeight - phase), nullptr };
+    };
+
+    // Drawn without the cache up front so the threads only compare
+    std::vector<std::vector<uint8_t>> expected;
+    for (int32_t image = 0; image < kNumImages; ++image)
+    {
+        for (const auto zoomLevel : kZoomLevels)
+        {
+            auto& pixels = expected.emplace_back(background);
+            const RenderTarget rt{ pixels.data(), 0, 0, kTargetWidth, kTargetHeight, 0 };
+            drawRLEAtZoom(rt, makeArgs(image, zoomLevel), zoomLevel);
+        }
+    }
+
+    // Threads draw the same images at once while another thread keeps invalidating the cache and
+    // reading its stats, so every thread has to drop its entries between draws.
+    std::atomic<uint32_t> mismatches = 0;
+    std::atomic<bool> isDrawing = true;
+    std::thread invalidator([&] {
+        while (isDrawing)
+        {
+            SpriteCache::invalidate();
+            SpriteCache::getStats();
+            std::this_thread::yield();
+        }
+    });
+    std::vector<std::thread> workers;
+    for (int32_t t = 0; t < 4; t++)
+    {
+        workers.emplace_back([&, t] {
+            auto pixels = background;
+            for (int32_t i = 0; i < 200; i++)
+            {
+                const auto image = (t + i) % kNumImages;
+                const auto zoomIndex = (i / kNumImages) % std::size(kZoomLevels);
+                const auto zoomLevel = kZoomLevels[zoomIndex];
+                std::copy(background.begin(), background.end(), pixels.begin());
+                const RenderTarget rt{ pixels.data(), 0, 0, kTargetWidth, kTargetHeight, 0 };
+                drawCachedRLEAtZoom(rt, makeArgs(image, zoomLevel), zoomLevel);
+                if (pixels != expected[image * std::size(kZoomLevels) + zoomIndex])
+                {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    isDrawing = false;
+    invalidator.join();
+
+    EXPECT_EQ(mismatches, 0u);
+    const auto stats = SpriteCache::getStats();
+    EXPECT_GT(stats.hits + stats.misses, 0u);
+    SpriteCache::invalidate();
+}
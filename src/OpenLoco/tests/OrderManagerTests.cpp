@@ -0,0 +1,283 @@
+#include <OpenLoco/Entities/EntityManager.h>
+#include <OpenLoco/GameState.h>
+#include <OpenLoco/S5/Limits.h>
+#include <OpenLoco/Vehicles/OrderManager.h>
+#include <OpenLoco/Vehicles/Orders.h>
+#include <OpenLoco/Vehicles/VehicleHead.h>
+#include <OpenLoco/Vehicles/VehicleManager.h>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace OpenLoco;
+using namespace OpenLoco::Vehicles;
+
+namespace
+{
+    class OrderManagerTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            EntityManager::reset();
+            OrderManager::reset();
+        }
+
+        void TearDown() override
+        {
+            OrderManager::reset();
+            EntityManager::reset();
+        }
+
+        static VehicleHead* createHead()
+        {
+            auto* base = EntityManager::createEntityVehicle();
+            if (base == nullptr)
+            {
+                ADD_FAILURE() << "out of entities";
+                return nullptr;
+            }
+            base->baseType = EntityBaseType::vehicle;
+            auto* vehicleBase = base->asBase<VehicleBase>();
+            vehicleBase->setSubType(VehicleEntityType::head);
+            EntityManager::moveEntityToList(vehicleBase, EntityManager::EntityListType::vehicleHead);
+
+            auto* head = vehicleBase->asVehicleHead();
+            OrderManager::allocateOrders(*head);
+            return head;
+        }
+
+        // Inserts the order just before the end order
+        static void appendOrder(VehicleHead& head, const Order& order)
+        {
+            OrderManager::insertOrder(&head, head.sizeOfOrderTable - 1, &order);
+        }
+
+        static OrderRouteWaypoint makeWaypoint(uint32_t seed)
+        {
+            return OrderRouteWaypoint(World::TilePos2(seed % 384, (seed / 384) % 384), static_cast<uint8_t>(seed % 200), seed % 4, seed % 10);
+        }
+
+        static std::vector<uint64_t> rawOrders(const VehicleHead& head)
+        {
+            std::vector<uint64_t> result;
+            for (auto& order : OrderRingView(head.orderTableOffset))
+            {
+                result.push_back(order.getRaw());
+            }
+            return result;
+        }
+
+        static uint64_t rawOrderAt(const uint8_t* table, uint32_t offset)
+        {
+            return reinterpret_cast<const Order*>(table + offset)->getRaw();
+        }
+
+        static uint32_t getChunkSize(const VehicleHead& head)
+        {
+            return std::bit_ceil(std::max<uint32_t>(head.sizeOfOrderTable, 16));
+        }
+
+        // Chunks of all vehicles must be disjoint
+        static void expectNoOverlappingChunks()
+        {
+            std::vector<std::pair<uint32_t, uint32_t>> chunks;
+            for (auto* head : VehicleManager::VehicleList())
+            {
+                chunks.emplace_back(head->orderTableOffset, head->orderTableOffset + getChunkSize(*head));
+            }
+            std::ranges::sort(chunks);
+            for (size_t i = 1; i < chunks.size(); ++i)
+            {
+                EXPECT_LE(chunks[i - 1].second, chunks[i].first) << "chunk " << i << " overlaps the previous one";
+            }
+        }
+    };
+}
+
+TEST_F(OrderManagerTest, InsertAndDeleteAcrossSizeClass)
+{
+    auto* head = createHead();
+    auto* neighbour = createHead();
+    ASSERT_NE(head, nullptr);
+    ASSERT_NE(neighbour, nullptr);
+    appendOrder(*neighbour, makeWaypoint(99));
+    const auto neighbourOrders = rawOrders(*neighbour);
+
+    // Three waypoints no longer fit the smallest chunk
+    std::vector<uint64_t> expected;
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        const auto waypoint = makeWaypoint(i);
+        appendOrder(*head, waypoint);
+        expected.push_back(waypoint.getRaw());
+    }
+    head->currentOrder = 12;
+    EXPECT_EQ(getChunkSize(*head), 32u);
+    EXPECT_EQ(rawOrders(*head), expected);
+    EXPECT_EQ(rawOrders(*neighbour), neighbourOrders);
+    EXPECT_EQ(OrderManager::orderTableLength(), 2 * sizeof(OrderEnd) + 4 * sizeof(OrderRouteWaypoint));
+    expectNoOverlappingChunks();
+
+    // Deleting the first order moves back into the smallest chunk and shifts the current order
+    OrderManager::deleteOrder(head, 0);
+    expected.erase(expected.begin());
+    EXPECT_EQ(getChunkSize(*head), 16u);
+    EXPECT_EQ(head->currentOrder, 12u - sizeof(OrderRouteWaypoint));
+    EXPECT_EQ(rawOrders(*head), expected);
+    EXPECT_EQ(rawOrders(*neighbour), neighbourOrders);
+    expectNoOverlappingChunks();
+
+    // Inserting at the front grows it again
+    const auto front = makeWaypoint(50);
+    OrderManager::insertOrder(head, 0, &front);
+    expected.insert(expected.begin(), front.getRaw());
+    EXPECT_EQ(getChunkSize(*head), 32u);
+    EXPECT_EQ(rawOrders(*head), expected);
+    EXPECT_EQ(rawOrders(*neighbour), neighbourOrders);
+    expectNoOverlappingChunks();
+}
+
+TEST_F(OrderManagerTest, CompactsWhenPoolIsExhausted)
+{
+    // The pool holds every vehicle at the largest chunk size, so with the smaller chunks left
+    // behind while growing it runs out before the last vehicles have grown.
+    constexpr uint32_t kNumOrders = 43;
+    static_assert(kNumOrders * sizeof(OrderRouteWaypoint) + sizeof(OrderEnd) > 256);
+
+    std::vector<VehicleHead*> heads;
+    for (size_t i = 0; i < Limits::kMaxVehicles; ++i)
+    {
+        auto* head = createHead();
+        ASSERT_NE(head, nullptr);
+        heads.push_back(head);
+    }
+
+    for (uint32_t i = 0; i < heads.size(); ++i)
+    {
+        for (uint32_t j = 0; j < kNumOrders; ++j)
+        {
+            appendOrder(*heads[i], makeWaypoint(i * kNumOrders + j));
+        }
+    }
+
+    for (uint32_t i = 0; i < heads.size(); ++i)
+    {
+        ASSERT_EQ(getChunkSize(*heads[i]), 512u);
+        const auto orders = rawOrders(*heads[i]);
+        ASSERT_EQ(orders.size(), kNumOrders);
+        for (uint32_t j = 0; j < kNumOrders; ++j)
+        {
+            ASSERT_EQ(orders[j], makeWaypoint(i * kNumOrders + j).getRaw()) << "vehicle " << i << " order " << j;
+        }
+    }
+    expectNoOverlappingChunks();
+}
+
+TEST_F(OrderManagerTest, RemoveOrdersForStation)
+{
+    const auto station = StationId(3);
+    const auto otherStation = StationId(4);
+
+    auto* head = createHead();
+    auto* other = createHead();
+    ASSERT_NE(head, nullptr);
+    ASSERT_NE(other, nullptr);
+
+    appendOrder(*head, OrderStopAt(station));
+    appendOrder(*head, makeWaypoint(1));
+    appendOrder(*head, OrderRouteThrough(station));
+    appendOrder(*head, OrderStopAt(otherStation));
+    appendOrder(*head, OrderUnloadAll(2));
+    appendOrder(*head, OrderStopAt(station));
+
+    appendOrder(*other, OrderStopAt(otherStation));
+    appendOrder(*other, OrderRouteThrough(station));
+
+    const auto lengthBefore = OrderManager::orderTableLength();
+    OrderManager::removeOrdersForStation(station);
+
+    const std::vector<uint64_t> expected{ makeWaypoint(1).getRaw(), OrderStopAt(otherStation).getRaw(), OrderUnloadAll(2).getRaw() };
+    EXPECT_EQ(rawOrders(*head), expected);
+    const std::vector<uint64_t> expectedOther{ OrderStopAt(otherStation).getRaw() };
+    EXPECT_EQ(rawOrders(*other), expectedOther);
+    EXPECT_EQ(OrderManager::orderTableLength(), lengthBefore - 2 * sizeof(OrderStopAt) - 2 * sizeof(OrderRouteThrough));
+    expectNoOverlappingChunks();
+}
+
+TEST_F(OrderManagerTest, ExportImportRoundTrip)
+{
+    auto* first = createHead();
+    auto* second = createHead();
+    auto* third = createHead();
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    ASSERT_NE(third, nullptr);
+
+    // Grow the first table after the others so the tables are out of order in the pool
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        appendOrder(*second, makeWaypoint(100 + i));
+        appendOrder(*third, makeWaypoint(200 + i));
+    }
+    for (uint32_t i = 0; i < 5; ++i)
+    {
+        appendOrder(*first, makeWaypoint(i));
+    }
+    ASSERT_GT(first->orderTableOffset, third->orderTableOffset);
+
+    const std::vector<VehicleHead*> heads{ first, second, third };
+    std::vector<std::vector<uint64_t>> expected;
+    for (auto* head : heads)
+    {
+        expected.push_back(rawOrders(*head));
+    }
+
+    OrderManager::generateNumDisplayFrames(first);
+    ASSERT_EQ(OrderManager::displayFrames().size(), 5u);
+    std::vector<uint64_t> frameOrders;
+    for (const auto& frame : OrderManager::displayFrames())
+    {
+        frameOrders.push_back(OrderRingView(frame.orderOffset).begin()->getRaw());
+    }
+
+    {
+        OrderManager::ScopedOrderTableExport orderTableExport;
+
+        // Written back to back in the S5 order table in pool order
+        const auto* flat = getGameState().orders;
+        EXPECT_EQ(second->orderTableOffset, 0u);
+        EXPECT_EQ(third->orderTableOffset, second->sizeOfOrderTable);
+        EXPECT_EQ(first->orderTableOffset, third->orderTableOffset + third->sizeOfOrderTable);
+        EXPECT_EQ(OrderManager::orderTableLength(), first->orderTableOffset + first->sizeOfOrderTable);
+        for (size_t i = 0; i < OrderManager::displayFrames().size(); ++i)
+        {
+            EXPECT_EQ(rawOrderAt(flat, OrderManager::displayFrames()[i].orderOffset), frameOrders[i]);
+        }
+        for (size_t i = 0; i < heads.size(); ++i)
+        {
+            for (size_t j = 0; j < expected[i].size(); ++j)
+            {
+                EXPECT_EQ(rawOrderAt(flat, heads[i]->orderTableOffset + j * sizeof(OrderRouteWaypoint)), expected[i][j]);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < heads.size(); ++i)
+    {
+        EXPECT_EQ(rawOrders(*heads[i]), expected[i]);
+    }
+    for (size_t i = 0; i < OrderManager::displayFrames().size(); ++i)
+    {
+        EXPECT_EQ(OrderRingView(OrderManager::displayFrames()[i].orderOffset).begin()->getRaw(), frameOrders[i]);
+    }
+    expectNoOverlappingChunks();
+
+    // Tables must still be editable after the import
+    appendOrder(*second, makeWaypoint(300));
+    expected[1].push_back(makeWaypoint(300).getRaw());
+    EXPECT_EQ(rawOrders(*second), expected[1]);
+    expectNoOverlappingChunks();
+}
@@ -0,0 +1,147 @@
+#include <OpenLoco/Entities/Entity.h>
+#include <OpenLoco/GameState.h>
+#include <OpenLoco/Map/Track/SubpositionData.h>
+#include <cstdint>
+#include <gtest/gtest.h>
+
+using namespace OpenLoco;
+using namespace OpenLoco::World::TrackData;
+
+namespace
+{
+    // FNV-1a over the size of each table followed by every entry in table order
+    class MoveInfoHasher
+    {
+        uint32_t _hash = 0x811C9DC5U;
+
+        void addByte(uint8_t value)
+        {
+            _hash ^= value;
+            _hash *= 0x01000193U;
+        }
+
+        void addU16(uint16_t value)
+        {
+            addByte(value & 0xFF);
+            addByte(value >> 8);
+        }
+
+    public:
+        size_t entries = 0;
+
+        void addTable(const MoveInfoSpan& table)
+        {
+            const auto size = static_cast<uint32_t>(table.size());
+            addU16(size & 0xFFFF);
+            addU16(size >> 16);
+            for (size_t i = 0; i < table.size(); ++i)
+            {
+                const auto moveInfo = table[i];
+                addU16(static_cast<uint16_t>(moveInfo.loc.x));
+                addU16(static_cast<uint16_t>(moveInfo.loc.y));
+                addU16(static_cast<uint16_t>(moveInfo.loc.z));
+                addByte(moveInfo.yaw);
+                addByte(static_cast<uint8_t>(moveInfo.pitch));
+                entries++;
+            }
+        }
+
+        uint32_t hash() const
+        {
+            return _hash;
+        }
+    };
+
+    // Hashes and entry counts of the unpacked 8 byte tables the packed ones were generated from
+    constexpr uint32_t kTrackHash = 0x775FB001U;
+    constexpr size_t kTrackEntries = 17926;
+    constexpr uint32_t kRoadLeftHandHash = 0x0AD64315U;
+    constexpr uint32_t kRoadRightHandHash = 0xA5EFE425U;
+    constexpr size_t kRoadEntries = 14100;
+    constexpr uint32_t kRoadPlacementHash = 0xD83742ADU;
+    constexpr size_t kRoadPlacementEntries = 3416;
+
+    constexpr uint16_t kNumTrackAndDirections = 352;
+    constexpr uint16_t kNumRoadAndDirections = 80;
+
+    MoveInfoHasher hashRoadTables()
+    {
+        MoveInfoHasher hasher;
+        for (uint16_t unk8 = 0; unk8 < 2; ++unk8)
+        {
+            for (uint16_t unk7 = 0; unk7 < 2; ++unk7)
+            {
+                for (uint16_t rad = 0; rad < kNumRoadAndDirections; ++rad)
+                {
+                    hasher.addTable(getRoadSubPositon((unk8 << 8) | (unk7 << 7) | rad));
+                }
+            }
+        }
+        return hasher;
+    }
+}
+
+TEST(SubpositionDataTest, PackedMoveInfoRoundTrips)
+{
+    const auto check = [](const MoveInfo& info) {
+        EXPECT_EQ(PackedMoveInfo(info).unpack(), info);
+    };
+
+    for (int16_t xy = -64; xy <= 191; ++xy)
+    {
+        check(MoveInfo{ World::Pos3{ xy, 0, 0 }, 0, Pitch::flat });
+        check(MoveInfo{ World::Pos3{ 0, xy, 0 }, 0, Pitch::flat });
+    }
+    for (int16_t z = -32; z <= 31; ++z)
+    {
+        check(MoveInfo{ World::Pos3{ 0, 0, z }, 0, Pitch::flat });
+    }
+    for (uint8_t yaw = 0; yaw < 64; ++yaw)
+    {
+        check(MoveInfo{ World::Pos3{ 95, -64, -32 }, yaw, Pitch::down20deg });
+    }
+    for (uint8_t pitch = 0; pitch <= static_cast<uint8_t>(Pitch::down20deg); ++pitch)
+    {
+        check(MoveInfo{ World::Pos3{ -64, 95, 31 }, 63, static_cast<Pitch>(pitch) });
+    }
+}
+
+TEST(SubpositionDataTest, TrackTablesMatchUnpackedData)
+{
+    MoveInfoHasher hasher;
+    for (uint16_t tad = 0; tad < kNumTrackAndDirections; ++tad)
+    {
+        hasher.addTable(getTrackSubPositon(tad));
+    }
+    EXPECT_EQ(hasher.entries, kTrackEntries);
+    EXPECT_EQ(hasher.hash(), kTrackHash);
+
+    const auto first = getTrackSubPositon(0)[0];
+    EXPECT_EQ(first, (MoveInfo{ World::Pos3{ 31, 16, 0 }, 0, Pitch::flat }));
+}
+
+TEST(SubpositionDataTest, RoadTablesMatchUnpackedData)
+{
+    getGameState().trafficHandedness = false;
+    const auto leftHand = hashRoadTables();
+    EXPECT_EQ(leftHand.entries, kRoadEntries);
+    EXPECT_EQ(leftHand.hash(), kRoadLeftHandHash);
+
+    getGameState().trafficHandedness = true;
+    const auto rightHand = hashRoadTables();
+    EXPECT_EQ(rightHand.entries, kRoadEntries);
+    EXPECT_EQ(rightHand.hash(), kRoadRightHandHash);
+
+    getGameState().trafficHandedness = false;
+}
+
+TEST(SubpositionDataTest, RoadPlacementTablesMatchUnpackedData)
+{
+    MoveInfoHasher hasher;
+    for (uint16_t rad = 0; rad < kNumRoadAndDirections; ++rad)
+    {
+        hasher.addTable(getRoadPlacementSubPositon(rad));
+    }
+    EXPECT_EQ(hasher.entries, kRoadPlacementEntries);
+    EXPECT_EQ(hasher.hash(), kRoadPlacementHash);
+}
@@ -10,8 +10,10 @@
 #include <OpenLoco/World/Station.h>
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstring>
 #include <gtest/gtest.h>
+#include <iostream>
 #include <vector>
 
 using namespace OpenLoco::World;
@@ -216,6 +218,27 @@ TEST_F(TileManagerTest, NumFreeElementsDecreasesMonotonicallyOnInsert)
     EXPECT_LT(afterSecond, afterFirst);
 }
 
+// The original allocator moved the tile to entriesEnd on every insert, so each insert used one
+// more entry than the tile had. The map generator stops placing forests based on this count.
+TEST_F(TileManagerTest, NumFreeElementsAppendOnlyMatchesOriginalAllocator)
+{
+    auto expected = TileManager::numFreeElementsAppendOnly();
+    EXPECT_EQ(expected, TileManager::numFreeElements());
+
+    const TilePos2 tiles[] = { kTestTile, kOtherTile, kTestTile, TilePos2{ 100, 100 }, kTestTile, kOtherTile };
+    for (const auto pos : tiles)
+    {
+        expected -= static_cast<uint32_t>(TileManager::get(pos).size()) + 1;
+        TileManager::insertElement(ElementType::tree, toWorldSpace(pos), 16, 0);
+        EXPECT_EQ(TileManager::numFreeElementsAppendOnly(), expected);
+    }
+    // Growing in place and reusing free runs left more space than that
+    EXPECT_GT(TileManager::numFreeElements(), expected);
+
+    TileManager::reorganise();
+    EXPECT_EQ(TileManager::numFreeElementsAppendOnly(), TileManager::numFreeElements());
+}
+
 TEST_F(TileManagerTest, InsertElementPropagatesOccupiedQuads)
 {
     auto* inserted = TileManager::insertElement(ElementType::track, toWorldSpace(kTestTile), 8, 0b1010);
@@ -555,6 +578,148 @@ TEST_F(TileManagerTest, GetEntriesCountGrowsAfterInsert)
     EXPECT_GT(TileManager::getEntries().size(), before);
 }
 
+TEST_F(TileManagerTest, InsertReusesFreedRunBeforeGrowingEntries)
+{
+    // Relocating two neighbouring tiles leaves a two entry hole where they used to be
+    TileManager::insertElement(ElementType::track, toWorldSpace(kTestTile), 8, 0);
+    TileManager::insertElement(ElementType::track, toWorldSpace(kOtherTile), 8, 0);
+    const auto before = TileManager::getEntries().size();
+
+    const TilePos2 thirdTile{ 12, 5 };
+    TileManager::insertElement(ElementType::tree, toWorldSpace(thirdTile), 8, 0);
+    EXPECT_EQ(TileManager::getEntries().size(), before);
+
+    auto tile = TileManager::get(thirdTile);
+    ASSERT_EQ(tile.size(), 2u);
+    EXPECT_EQ(typeAt(tile, 0), ElementType::surface);
+    EXPECT_EQ(typeAt(tile, 1), ElementType::tree);
+    EXPECT_EQ(&*tile.begin(), &*TileManager::getEntries().begin() + (5 * kMapColumns + 10));
+}
+
+TEST_F(TileManagerTest, InsertGrowsTileInPlaceWhenNextEntryIsFree)
+{
+    // The first insert moves the tile to the end, after which it can keep growing where it is
+    TileManager::insertElement(ElementType::track, toWorldSpace(kTestTile), 16, 0);
+    auto* first = &*TileManager::get(kTestTile).begin();
+    const auto before = TileManager::getEntries().size();
+
+    TileManager::insertElement(ElementType::tree, toWorldSpace(kTestTile), 8, 0);
+    EXPECT_EQ(TileManager::getEntries().size(), before + 1);
+
+    auto tile = TileManager::get(kTestTile);
+    ASSERT_EQ(tile.size(), 3u);
+    EXPECT_EQ(&*tile.begin(), first);
+    EXPECT_EQ(typeAt(tile, 0), ElementType::surface);
+    EXPECT_EQ(typeAt(tile, 1), ElementType::tree);
+    EXPECT_EQ(typeAt(tile, 2), ElementType::track);
+    EXPECT_FALSE(tile[1]->isLast());
+    EXPECT_TRUE(tile[2]->isLast());
+}
+
+TEST_F(TileManagerTest, FragmentationStatsTrackFreeRuns)
+{
+    auto stats = TileManager::getFragmentationStats();
+    EXPECT_EQ(stats.entriesEnd, TileManager::getEntries().size());
+    EXPECT_EQ(stats.freeRuns, 0u);
+    EXPECT_EQ(stats.freeEntries, 0u);
+    EXPECT_EQ(stats.largestFreeRun, 0u);
+
+    TileManager::insertElement(ElementType::track, toWorldSpace(kTestTile), 8, 0);
+    TileManager::insertElement(ElementType::track, toWorldSpace(kOtherTile), 8, 0);
+    stats = TileManager::getFragmentationStats();
+    EXPECT_EQ(stats.entriesEnd, TileManager::getEntries().size());
+    EXPECT_EQ(stats.freeRuns, 1u);
+    EXPECT_EQ(stats.freeEntries, 2u);
+    EXPECT_EQ(stats.largestFreeRun, 2u);
+
+    // Fills the two entry run and leaves a single entry behind
+    TileManager::insertElement(ElementType::track, toWorldSpace(TilePos2{ 100, 100 }), 8, 0);
+    stats = TileManager::getFragmentationStats();
+    EXPECT_EQ(stats.freeRuns, 1u);
+    EXPECT_EQ(stats.freeEntries, 1u);
+    EXPECT_EQ(stats.largestFreeRun, 1u);
+
+    TileManager::reorganise();
+    stats = TileManager::getFragmentationStats();
+    EXPECT_EQ(stats.freeRuns, 0u);
+    EXPECT_EQ(stats.freeEntries, 0u);
+}
+
+// The third tile moves into the run its neighbours left right before it. The run must not be
+// merged with the entry the new element is going into.
+TEST_F(TileManagerTest, InsertOnTopIntoPrecedingFreeRun)
+{
+    constexpr TilePos2 kThirdTile{ 12, 5 };
+    TileManager::insertElement(ElementType::track, toWorldSpace(kTestTile), 8, 0);
+    TileManager::insertElement(ElementType::track, toWorldSpace(kOtherTile), 8, 0);
+    auto* third = &*TileManager::get(kThirdTile).begin();
+
+    TileManager::insertElement(ElementType::track, toWorldSpace(kThirdTile), 8, 0);
+    auto tile = TileManager::get(kThirdTile);
+    ASSERT_EQ(tile.size(), 2u);
+    EXPECT_EQ(&*tile.begin(), third - 2);
+    EXPECT_EQ(typeAt(tile, 1), ElementType::track);
+    EXPECT_TRUE(tile[1]->isLast());
+
+    const auto stats = TileManager::getFragmentationStats();
+    EXPECT_EQ(stats.freeRuns, 1u);
+    EXPECT_EQ(stats.freeEntries, 1u);
+    EXPECT_EQ(stats.largestFreeRun, 1u);
+}
+
+TEST_F(TileManagerTest, FragmentationStatsMatchEntriesAfterChurn)
+{
+    uint32_t seed = 1;
+    const auto next = [&seed] {
+        seed = seed * 1664525U + 1013904223U;
+        return seed >> 8;
+    };
+    for (int i = 0; i < 20000; ++i)
+    {
+        const TilePos2 pos{ static_cast<int16_t>(next() % 48), static_cast<int16_t>(next() % 48) };
+        auto tile = TileManager::get(pos);
+        if (next() % 2 == 0 && tile.size() < 40)
+        {
+            TileManager::insertElement(ElementType::tree, toWorldSpace(pos), static_cast<uint8_t>(4 + next() % 60), 0);
+        }
+        else if (tile.size() > 1)
+        {
+            TileManager::removeElement(*tile[1 + next() % (tile.size() - 1)]);
+        }
+        if (i % 16 == 0)
+        {
+            TileManager::defragmentTilePeriodic();
+        }
+    }
+
+    TileManager::FragmentationStats expected{};
+    const auto entries = TileManager::getEntries();
+    expected.entriesEnd = static_cast<uint32_t>(entries.size());
+    for (size_t i = 0; i < entries.size();)
+    {
+        if (!entries[i].isEmpty())
+        {
+            i++;
+            continue;
+        }
+        const auto start = i;
+        while (i < entries.size() && entries[i].isEmpty())
+        {
+            i++;
+        }
+        expected.freeRuns++;
+        expected.freeEntries += static_cast<uint32_t>(i - start);
+        expected.largestFreeRun = std::max(expected.largestFreeRun, static_cast<uint32_t>(i - start));
+    }
+    ASSERT_FALSE(entries.back().isEmpty());
+
+    const auto stats = TileManager::getFragmentationStats();
+    EXPECT_EQ(stats.entriesEnd, expected.entriesEnd);
+    EXPECT_EQ(stats.freeRuns, expected.freeRuns);
+    EXPECT_EQ(stats.freeEntries, expected.freeEntries);
+    EXPECT_EQ(stats.largestFreeRun, expected.largestFreeRun);
+}
+
 TEST_F(TileManagerTest, UpdateTilePointersRebuildsConsistently)
 {
     TileManager::insertElement(ElementType::track, toWorldSpace(kTestTile), 8, 0);
@@ -975,3 +1140,144 @@ TEST_F(TileManagerTest, ReorganiseAfterChurnMatchesByteShadow)
             << "tile (" << tilesOfInterest[i].x << "," << tilesOfInterest[i].y << ") diverged after reorganise";
     }
 }
+
+TEST_F(TileManagerTest, RepackElementStoresPacksInTileOrder)
+{
+    // Insert in reverse tile order so the store indices are reversed too
+    const std::vector<TilePos2> tiles{
+        TilePos2{ 60, 40 }, TilePos2{ 50, 40 }, TilePos2{ 40, 40 }, TilePos2{ 30, 20 }, TilePos2{ 20, 20 }
+    };
+    for (auto t : tiles)
+    {
+        TileManager::insertElement(ElementType::tree, toWorldSpace(t), 16, 0);
+    }
+
+    std::vector<TileBytes> before;
+    for (auto t : tiles)
+    {
+        before.push_back(snapshotBytes(TileManager::get(t)));
+    }
+
+    TileManager::repackElementStores();
+
+    std::vector<uint32_t> treeIndices;
+    for (auto it = tiles.rbegin(); it != tiles.rend(); ++it)
+    {
+        for (auto& el : TileManager::get(*it))
+        {
+            if (el.type() == ElementType::tree)
+            {
+                treeIndices.push_back(el.index());
+            }
+        }
+    }
+    ASSERT_EQ(treeIndices.size(), tiles.size());
+    EXPECT_TRUE(std::is_sorted(treeIndices.begin(), treeIndices.end()));
+
+    for (size_t i = 0; i < tiles.size(); ++i)
+    {
+        EXPECT_EQ(before[i], snapshotBytes(TileManager::get(tiles[i])));
+    }
+}
+
+TEST_F(TileManagerTest, ReorganiseKeepsElementReferencesValid)
+{
+    auto* first = TileManager::insertElement(ElementType::tree, toWorldSpace(kTestTile), 16, 0);
+    TileManager::insertElement(ElementType::tree, toWorldSpace(kOtherTile), 16, 0);
+    ASSERT_NE(first, nullptr);
+    auto* tree = first->as<TreeElement>();
+    ASSERT_NE(tree, nullptr);
+
+    TileManager::reorganise();
+
+    TreeElement* after = nullptr;
+    for (auto& el : TileManager::get(kTestTile))
+    {
+        if (auto* elTree = el.as<TreeElement>())
+        {
+            after = elTree;
+        }
+    }
+    EXPECT_EQ(after, tree);
+}
+
+// Microbenchmark of full map tile walks with element stores fragmented by play versus
+// packed by repackElementStores. Run with --gtest_also_run_disabled_tests.
+TEST_F(TileManagerTest, DISABLED_TileWalkThroughput)
+{
+    // Place trees on every other tile in a scattered order so that neighbouring tiles
+    // reference distant store slots, as happens after a long game.
+    std::vector<TilePos2> tiles;
+    for (OpenLoco::tile_coord_t y = 0; y < kMapRows; y++)
+    {
+        for (OpenLoco::tile_coord_t x = static_cast<OpenLoco::tile_coord_t>(y & 1); x < kMapColumns; x += 2)
+        {
+            tiles.push_back(TilePos2{ x, y });
+        }
+    }
+    uint32_t seed = 12345;
+    for (size_t i = tiles.size() - 1; i > 0; i--)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        std::swap(tiles[i], tiles[seed % (i + 1)]);
+    }
+    for (auto t : tiles)
+    {
+        TileManager::insertElement(ElementType::tree, toWorldSpace(t), 16, 0);
+    }
+
+    const auto measure = [](const char* name, auto&& walk) {
+        constexpr int kIterations = 10;
+        int64_t checksum = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kIterations; i++)
+        {
+            checksum += walk();
+        }
+        const auto ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "  " << name << ": " << ms / kIterations << " ms per map walk (checksum " << checksum << ")\n";
+        return checksum;
+    };
+
+    const auto walkHeights = [] {
+        int64_t sum = 0;
+        for (OpenLoco::tile_coord_t y = 0; y < kMapRows; y++)
+        {
+            for (OpenLoco::tile_coord_t x = 0; x < kMapColumns; x++)
+            {
+                sum += TileManager::getHeight(toWorldSpace(TilePos2{ x, y }) + Pos2{ 16, 16 }).landHeight;
+            }
+        }
+        return sum;
+    };
+
+    // Mimics the element scan of TileClearance: test every element for a vertical overlap.
+    const auto walkClearance = [] {
+        int64_t collisions = 0;
+        for (OpenLoco::tile_coord_t y = 0; y < kMapRows; y++)
+        {
+            for (OpenLoco::tile_coord_t x = 0; x < kMapColumns; x++)
+            {
+                for (auto& el : TileManager::get(TilePos2{ x, y }))
+                {
+                    if (el.isGhost() || el.baseZ() >= 20 || el.clearZ() <= 8)
+                    {
+                        continue;
+                    }
+                    collisions += el.occupiedQuarter() != 0 ? 2 : 1;
+                }
+            }
+        }
+        return collisions;
+    };
+
+    std::cout << "Fragmented stores\n";
+    const auto heightsBefore = measure("getHeight", walkHeights);
+    const auto clearanceBefore = measure("clearance", walkClearance);
+
+    TileManager::repackElementStores();
+
+    std::cout << "Packed stores\n";
+    EXPECT_EQ(measure("getHeight", walkHeights), heightsBefore);
+    EXPECT_EQ(measure("clearance", walkClearance), clearanceBefore);
+}
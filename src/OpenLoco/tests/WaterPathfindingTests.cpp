@@ -0,0 +1,204 @@
+#include <OpenLoco/Engine/World.hpp>
+#include <OpenLoco/Map/SurfaceElement.h>
+#include <OpenLoco/Map/Tile.h>
+#include <OpenLoco/Map/TileManager.h>
+#include <OpenLoco/Map/TreeElement.h>
+#include <OpenLoco/Vehicles/WaterPathfinding.h>
+#include <algorithm>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+
+using namespace OpenLoco;
+using namespace OpenLoco::World;
+using namespace OpenLoco::Vehicles;
+
+namespace
+{
+    constexpr MicroZ kWaterMicroZ = 4;
+    constexpr PathFindingResult kNoResult{ std::numeric_limits<uint16_t>::max(), std::numeric_limits<uint8_t>::max() };
+
+    // Vanilla 0x00428237, which recursed into every neighbour up to cost 7 without a visited set
+    PathFindingResult vanillaWaterPathfindToTarget(const TilePos2 tilePos, const MicroZ waterMicroZ, const TilePos2 targetOrderPos, const NearbyBoats& nearbyVehicles, uint8_t cost, const PathFindingResult& bestResult)
+    {
+        PathFindingResult result = bestResult;
+        if (!validCoords(tilePos))
+        {
+            return result;
+        }
+
+        auto tile = TileManager::get(tilePos);
+        auto* surfaceEntry = tile.surfaceEntry();
+        if (surfaceEntry == nullptr)
+        {
+            return result;
+        }
+
+        auto* surfaceEl = surfaceEntry->as<SurfaceElement>();
+        if (surfaceEl != nullptr && surfaceEl->water() != waterMicroZ)
+        {
+            return result;
+        }
+        if (!surfaceEntry->isLast())
+        {
+            auto* elObsticle = surfaceEntry->next();
+            if (elObsticle != nullptr && !elObsticle->isGhost() && !elObsticle->isAiAllocated())
+            {
+                if (elObsticle->baseZ() / kMicroToSmallZStep - waterMicroZ < 1)
+                {
+                    return result;
+                }
+            }
+        }
+
+        const auto nearbyIndex = tilePos - nearbyVehicles.startTile;
+        if (nearbyIndex.x >= 0 && nearbyIndex.x < 16 && nearbyIndex.y >= 0 && nearbyIndex.y < 16)
+        {
+            if (nearbyVehicles.searchResult[nearbyIndex.x][nearbyIndex.y])
+            {
+                return result;
+            }
+        }
+        auto distToTarget = toWorldSpace(tilePos - targetOrderPos);
+        distToTarget.x = std::abs(distToTarget.x);
+        distToTarget.y = std::abs(distToTarget.y);
+        const uint16_t score = std::max(distToTarget.x, distToTarget.y) + std::min(distToTarget.x, distToTarget.y) / 16;
+        result = std::min(result, PathFindingResult{ score, cost });
+        if (score != 0)
+        {
+            if (cost >= 7)
+            {
+                return result;
+            }
+            cost++;
+            for (auto i = 0U; i < 4; ++i)
+            {
+                result = vanillaWaterPathfindToTarget(tilePos + toTileSpace(kRotationOffset[i]), waterMicroZ, targetOrderPos, nearbyVehicles, cost, result);
+            }
+        }
+        return result;
+    }
+
+    class WaterPathfindingTest : public ::testing::Test
+    {
+    protected:
+        static void SetUpTestSuite()
+        {
+            TileManager::allocateMapElements();
+        }
+
+        void SetUp() override
+        {
+            TileManager::initialise();
+        }
+
+        static void setWater(const TilePos2 pos, const MicroZ level)
+        {
+            TileManager::get(pos).surface()->setWater(level);
+        }
+
+        // Water, dry land and obstacles at random around origin. Obstacles are above or below the
+        // water line and some are ghosts or AI allocated, which boats ignore.
+        static void makeRandomWater(std::mt19937& rng, const TilePos2 origin, const uint32_t waterChance)
+        {
+            constexpr int32_t kRadius = 12;
+            for (auto x = origin.x - kRadius; x <= origin.x + kRadius; x++)
+            {
+                for (auto y = origin.y - kRadius; y <= origin.y + kRadius; y++)
+                {
+                    const TilePos2 pos(x, y);
+                    if (!validCoords(pos))
+                    {
+                        continue;
+                    }
+                    setWater(pos, rng() % 100 < waterChance ? kWaterMicroZ : rng() % kWaterMicroZ);
+                    if (rng() % 8 == 0)
+                    {
+                        constexpr SmallZ kObstacleZ[] = { 8, 16, 19, 20, 24, 40 };
+                        auto* obstacle = TileManager::insertElement<TreeElement>(toWorldSpace(pos), kObstacleZ[rng() % std::size(kObstacleZ)], 0xF);
+                        obstacle->setGhost(rng() % 4 == 0);
+                        obstacle->setAiAllocated(rng() % 4 == 0);
+                    }
+                }
+            }
+        }
+
+        // Compares the searches in the four directions made by waterPathfind
+        static void expectSameAsVanilla(const TilePos2 origin, const TilePos2 target, const NearbyBoats& nearbyBoats)
+        {
+            WaterPassabilityCache passability(origin, kWaterMicroZ, nearbyBoats);
+            for (auto i = 0U; i < 4; ++i)
+            {
+                const auto tilePos = origin + toTileSpace(kRotationOffset[i]);
+                const auto expected = vanillaWaterPathfindToTarget(tilePos, kWaterMicroZ, target, nearbyBoats, 0, kNoResult);
+                const auto actual = waterPathfindToTarget(tilePos, target, passability);
+                EXPECT_EQ(actual, expected) << "origin " << origin.x << "," << origin.y << " target " << target.x << "," << target.y << " direction " << i;
+            }
+        }
+    };
+}
+
+TEST_F(WaterPathfindingTest, MatchesVanillaOnRandomWater)
+{
+    std::mt19937 rng(11);
+    // The last origins put part of the search off the map
+    constexpr TilePos2 kOrigins[] = { TilePos2(100, 100), TilePos2(200, 57), TilePos2(3, 4), TilePos2(1, 120) };
+    for (auto iteration = 0; iteration < 200; iteration++)
+    {
+        TileManager::initialise();
+        const auto origin = kOrigins[iteration % std::size(kOrigins)];
+        makeRandomWater(rng, origin, 50 + rng() % 50);
+
+        NearbyBoats nearbyBoats{};
+        nearbyBoats.startTile = origin - TilePos2(7, 7);
+        for (auto& column : nearbyBoats.searchResult)
+        {
+            for (auto& hasBoat : column)
+            {
+                hasBoat = rng() % 10 == 0;
+            }
+        }
+
+        // Targets within reach, on the origin and far away
+        const TilePos2 nearTarget(origin.x + static_cast<int32_t>(rng() % 17) - 8, origin.y + static_cast<int32_t>(rng() % 17) - 8);
+        expectSameAsVanilla(origin, nearTarget, nearbyBoats);
+        expectSameAsVanilla(origin, origin, nearbyBoats);
+        expectSameAsVanilla(origin, TilePos2(rng() % 384, rng() % 384), nearbyBoats);
+    }
+}
+
+// Vanilla only looked up boats on the 16x16 tiles starting 7 tiles before the origin, so tiles
+// 8 tiles before or 9 tiles after it are never blocked by a boat.
+TEST_F(WaterPathfindingTest, NearbyBoatsOnlyCoverSearchResultRange)
+{
+    const TilePos2 origin(100, 100);
+    for (auto x = origin.x - 12; x <= origin.x + 12; x++)
+    {
+        for (auto y = origin.y - 12; y <= origin.y + 12; y++)
+        {
+            setWater(TilePos2(x, y), kWaterMicroZ);
+        }
+    }
+
+    NearbyBoats nearbyBoats{};
+    nearbyBoats.startTile = origin - TilePos2(7, 7);
+    for (auto& column : nearbyBoats.searchResult)
+    {
+        column.fill(true);
+    }
+
+    const TilePos2 target(origin.x + 20, origin.y);
+    WaterPassabilityCache passability(origin, kWaterMicroZ, nearbyBoats);
+    for (const auto startPos : { TilePos2(origin.x - 7, origin.y), TilePos2(origin.x + 8, origin.y) })
+    {
+        EXPECT_EQ(waterPathfindToTarget(startPos, target, passability), kNoResult);
+        EXPECT_EQ(vanillaWaterPathfindToTarget(startPos, kWaterMicroZ, target, nearbyBoats, 0, kNoResult), kNoResult);
+    }
+    for (const auto startPos : { TilePos2(origin.x - 8, origin.y), TilePos2(origin.x + 9, origin.y) })
+    {
+        const auto result = waterPathfindToTarget(startPos, target, passability);
+        EXPECT_NE(result, kNoResult);
+        EXPECT_EQ(result, vanillaWaterPathfindToTarget(startPos, kWaterMicroZ, target, nearbyBoats, 0, kNoResult));
+    }
+}